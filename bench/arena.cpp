@@ -0,0 +1,133 @@
+/**
+ * @file arena.cpp
+ * @brief Mede o tempo de carga e de destruição dos grafos, cujos nós e arestas saem das arenas.
+ *
+ * Uso: bench_arena [-m|-l] [arquivo] [repetições]
+ * Para cada repetição, carrega o grafo (padrão: entradas/grafo1.txt como lista) e o destrói, e imprime as médias.
+ * Em seguida compara, para o mesmo número de arestas, a alocação e liberação de objetos do tamanho de uma Aresta pela
+ * Arena (liberada de uma vez) e por new/delete individuais, que era o caminho anterior às arenas.
+ */
+
+#include "../include/Arena.h"
+#include "../include/Aresta.h"
+#include "../include/Grafo.h"
+#include "../include/GrafoLista.h"
+#include "../include/GrafoMatriz.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/**
+ * @brief Tempo decorrido desde um instante.
+ * @param inicio Instante inicial.
+ * @return Tempo em milissegundos.
+ */
+double milissegundos(chrono::steady_clock::time_point inicio)
+{
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+}
+
+int main(int argc, char *argv[])
+{
+    bool matriz = false;
+    string arquivo = "entradas/grafo1.txt";
+    int repeticoes = 5;
+    int posicional = 0;
+    for (int i = 1; i < argc; i++)
+    {
+        string argumento = argv[i];
+        if (argumento == "-m" || argumento == "-l")
+        {
+            matriz = argumento == "-m";
+        }
+        else if (posicional++ == 0)
+        {
+            arquivo = argumento;
+        }
+        else
+        {
+            repeticoes = atoi(argv[i]);
+        }
+    }
+    if (repeticoes <= 0)
+    {
+        cout << "Erro: o número de repetições deve ser positivo." << endl;
+        return 1;
+    }
+
+    double tempoCarga = 0, tempoDestruicao = 0;
+    int ordem = 0, numArestas = 0;
+    streambuf *saida = cout.rdbuf();
+    ostringstream descarte;
+    for (int r = 0; r < repeticoes; r++)
+    {
+        chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+        Grafo *grafo = matriz ? static_cast<Grafo *>(new GrafoMatriz(0, true, true, true))
+                              : static_cast<Grafo *>(new GrafoLista(0, true, true, true));
+        cout.rdbuf(descarte.rdbuf()); // Silencia as mensagens da carga
+        grafo->carregaGrafo(arquivo);
+        cout.rdbuf(saida);
+        tempoCarga += milissegundos(inicio);
+        ordem = grafo->getOrdem();
+        numArestas = grafo->getNumArestas();
+        if (ordem == 0)
+        {
+            delete grafo; // A carga já informou o erro
+            return 1;
+        }
+
+        inicio = chrono::steady_clock::now();
+        delete grafo;
+        tempoDestruicao += milissegundos(inicio);
+    }
+
+    cout << fixed << setprecision(3);
+    cout << arquivo << " como " << (matriz ? "matriz" : "lista") << " (" << ordem << " vértices, " << numArestas
+         << " arestas), média de " << repeticoes << " execuções:" << endl;
+    cout << "  carga:      " << setw(10) << tempoCarga / repeticoes << " ms" << endl;
+    cout << "  destruição: " << setw(10) << tempoDestruicao / repeticoes << " ms" << endl;
+
+    // Alocação isolada, com duas posições por aresta do grafo (as duas pontas de uma aresta não direcionada)
+    int numObjetos = 2 * numArestas;
+    vector<void *> objetos(numObjetos);
+    double tempoArena = 0, tempoLiberaTudo = 0, tempoNew = 0, tempoDelete = 0;
+    for (int r = 0; r < repeticoes; r++)
+    {
+        Arena arena(sizeof(Aresta));
+        chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+        for (int i = 0; i < numObjetos; i++)
+        {
+            objetos[i] = arena.aloca();
+        }
+        tempoArena += milissegundos(inicio);
+        inicio = chrono::steady_clock::now();
+        arena.liberaTudo();
+        tempoLiberaTudo += milissegundos(inicio);
+
+        inicio = chrono::steady_clock::now();
+        for (int i = 0; i < numObjetos; i++)
+        {
+            objetos[i] = ::operator new(sizeof(Aresta));
+        }
+        tempoNew += milissegundos(inicio);
+        inicio = chrono::steady_clock::now();
+        for (int i = 0; i < numObjetos; i++)
+        {
+            ::operator delete(objetos[i]);
+        }
+        tempoDelete += milissegundos(inicio);
+    }
+    cout << numObjetos << " objetos de " << sizeof(Aresta) << " bytes:" << endl;
+    cout << "  arena:      " << setw(10) << tempoArena / repeticoes << " ms alocação, " << setw(10)
+         << tempoLiberaTudo / repeticoes << " ms liberação" << endl;
+    cout << "  new/delete: " << setw(10) << tempoNew / repeticoes << " ms alocação, " << setw(10)
+         << tempoDelete / repeticoes << " ms liberação" << endl;
+    return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file delta_stepping.cpp
+ * @brief Compara o delta-stepping com o Dijkstra serial (distanciasDijkstra) e com menorDistancia.
+ *
+ * Uso: bench_delta [-m|-l] [arquivos...]
+ * Sem arquivos, usa os grafos de entradas/ com arestas ponderadas. Para cada grafo, sorteia origens com semente fixa,
+ * mede o tempo médio por origem de cada método e confere se as distâncias coincidem com as do Dijkstra.
+ * menorDistancia é medida até o vértice alcançável mais distante, de modo que explora quase todo o grafo.
+ */
+
+#include "../include/Grafo.h"
+#include "../include/GrafoLista.h"
+#include "../include/GrafoMatriz.h"
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/// Número de origens sorteadas por grafo.
+const int NUM_ORIGENS = 20;
+
+/**
+ * @brief Mede o tempo de uma chamada.
+ * @param chamada Código a medir.
+ * @return Tempo em milissegundos.
+ */
+double cronometra(const function<void()> &chamada)
+{
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    chamada();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+}
+
+/**
+ * @brief Maior diferença entre duas listas de distâncias (0 se os mesmos vértices são inalcançáveis em ambas).
+ */
+double maiorDiferenca(const vector<double> &a, const vector<double> &b)
+{
+    double diferenca = 0;
+    for (size_t v = 0; v < a.size(); v++)
+    {
+        if (std::isinf(a[v]) != std::isinf(b[v]))
+        {
+            return numeric_limits<double>::infinity();
+        }
+        if (!std::isinf(a[v]))
+        {
+            diferenca = max(diferenca, fabs(a[v] - b[v]));
+        }
+    }
+    return diferenca;
+}
+
+/**
+ * @brief Carrega um grafo e imprime a linha de tempos dele.
+ * @param arquivo Caminho do grafo.
+ * @param matriz Indica se o grafo é carregado como matriz.
+ */
+void comparaGrafo(const string &arquivo, bool matriz)
+{
+    Grafo *grafo = matriz ? static_cast<Grafo *>(new GrafoMatriz(0, true, true, true))
+                          : static_cast<Grafo *>(new GrafoLista(0, true, true, true));
+
+    // Silencia as mensagens da carga
+    streambuf *saida = cout.rdbuf();
+    ostringstream descarte;
+    cout.rdbuf(descarte.rdbuf());
+    grafo->carregaGrafo(arquivo);
+    cout.rdbuf(saida);
+
+    int numIndices = grafo->getNumIndices();
+    if (grafo->getOrdem() == 0)
+    {
+        delete grafo; // A carga já informou o erro
+        return;
+    }
+
+    double tempoDijkstra = 0, tempoSerial = 0, tempoParalelo = 0, tempoMenor = 0, diferenca = 0;
+    int medidas = 0;
+    srand(1);
+    for (int i = 0; i < NUM_ORIGENS; i++)
+    {
+        int origem = rand() % numIndices;
+        if (grafo->estaRemovido(origem))
+        {
+            continue;
+        }
+        vector<double> referencia, serial, paralelo;
+        bool valido = true;
+        tempoDijkstra += cronometra([&]() { valido = grafo->distanciasDijkstra(origem, referencia); });
+        if (!valido)
+        {
+            delete grafo; // Pesos negativos: o Dijkstra já informou o erro
+            return;
+        }
+        tempoSerial += cronometra([&]() { grafo->deltaStepping(origem, serial, 0, 1); });
+        tempoParalelo += cronometra([&]() { grafo->deltaStepping(origem, paralelo, 0, 0); });
+        diferenca = max(diferenca, max(maiorDiferenca(referencia, serial), maiorDiferenca(referencia, paralelo)));
+
+        int destino = origem;
+        for (int v = 0; v < numIndices; v++)
+        {
+            if (!std::isinf(referencia[v]) && referencia[v] > referencia[destino])
+            {
+                destino = v;
+            }
+        }
+        tempoMenor += cronometra([&]() { grafo->menorDistancia(origem, destino); });
+        medidas++;
+    }
+
+    if (medidas > 0)
+    {
+        cout << left << setw(24) << arquivo << right << fixed << setprecision(3) << setw(12) << tempoDijkstra / medidas
+             << setw(12) << tempoSerial / medidas << setw(12) << tempoParalelo / medidas << setw(12) << tempoMenor / medidas
+             << setw(12) << scientific << setprecision(1) << diferenca << endl;
+    }
+    delete grafo;
+}
+
+int main(int argc, char *argv[])
+{
+    bool matriz = false;
+    vector<string> arquivos;
+    for (int i = 1; i < argc; i++)
+    {
+        string argumento = argv[i];
+        if (argumento == "-m" || argumento == "-l")
+        {
+            matriz = argumento == "-m";
+        }
+        else
+        {
+            arquivos.push_back(argumento);
+        }
+    }
+    if (arquivos.empty())
+    {
+        arquivos = {"entradas/grafo1.txt", "entradas/grafo2.txt", "entradas/grafo8.txt", "entradas/grafo9.txt"};
+    }
+
+    cout << "Tempo médio por origem (ms), " << NUM_ORIGENS << " origens por grafo:" << endl;
+    cout << left << setw(24) << "grafo" << right << setw(12) << "dijkstra" << setw(12) << "delta x1" << setw(12)
+         << "delta xN" << setw(12) << "menorDist" << setw(12) << "dif. max" << endl;
+    for (const string &arquivo : arquivos)
+    {
+        comparaGrafo(arquivo, matriz);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file varredura_linha.cpp
+ * @brief Mede a vazão (GB/s) de cada varredura de VarreduraLinha sobre uma linha da matriz.
+ *
+ * Uso: bench_varredura [tamanho da linha] [repetições]
+ * Mede a implementação escolhida para o processador; com GRAFO_SEM_SIMD definida, mede a escalar.
+ */
+
+#include "../include/VarreduraLinha.h"
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+
+/// Recebe o resultado das varreduras, para que o compilador não as descarte.
+volatile long long sumidouro;
+
+/**
+ * @brief Executa uma varredura repetidas vezes e imprime a vazão obtida.
+ * @param nome Nome da varredura.
+ * @param bytesPorChamada Bytes lidos e escritos em cada chamada.
+ * @param repeticoes Número de chamadas medidas.
+ * @param varredura Chamada a medir.
+ */
+void mede(const char *nome, double bytesPorChamada, int repeticoes, const function<long long()> &varredura)
+{
+    long long acumulado = varredura(); // Aquece as caches
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    for (int r = 0; r < repeticoes; r++)
+    {
+        acumulado += varredura();
+    }
+    double segundos = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    cout << left << setw(16) << nome << right << setw(10) << fixed << setprecision(1)
+         << bytesPorChamada * repeticoes / segundos / 1e9 << " GB/s" << endl;
+    sumidouro = acumulado;
+}
+
+int main(int argc, char *argv[])
+{
+    int n = argc > 1 ? atoi(argv[1]) : 8192;
+    int repeticoes = argc > 2 ? atoi(argv[2]) : 100000;
+    if (n <= 0 || repeticoes <= 0)
+    {
+        cout << "Erro: tamanho da linha e repetições devem ser positivos." << endl;
+        return 1;
+    }
+
+    // Linha com uma aresta a cada 64 células e todos os vizinhos cobertos, exceto o último: as buscas percorrem
+    // a linha inteira
+    vector<int> linha(n, 0), cobertos(n, 1), vazia(n, 0);
+    for (int j = 0; j < n; j += 64)
+    {
+        linha[j] = 1;
+    }
+    linha[n - 1] = 1;
+    vazia[n - 1] = 1;
+    cobertos[n - 1] = 0;
+    vector<float> destino(n, 1e9f), origem(n, 1.0f);
+
+    cout << "Implementação: " << VarreduraLinha::implementacao() << ", linha de " << n << " células, " << repeticoes
+         << " repetições" << endl;
+    double bytesLinha = static_cast<double>(n) * sizeof(int);
+    mede("contaNaoNulos", bytesLinha, repeticoes, [&]() { return VarreduraLinha::contaNaoNulos(linha.data(), n); });
+    mede("contaLivres", 2 * bytesLinha, repeticoes,
+         [&]() { return VarreduraLinha::contaLivres(linha.data(), cobertos.data(), n); });
+    mede("proximoNaoNulo", bytesLinha, repeticoes, [&]() { return VarreduraLinha::proximoNaoNulo(vazia.data(), 0, n); });
+    mede("proximoLivre", 2 * bytesLinha, repeticoes,
+         [&]() { return VarreduraLinha::proximoLivre(linha.data(), cobertos.data(), 0, n); });
+    mede("minMais", 3 * static_cast<double>(n) * sizeof(float), repeticoes, [&]()
+    {
+        VarreduraLinha::minMais(destino.data(), origem.data(), 0.5f, n);
+        return static_cast<long long>(destino[n - 1]);
+    });
+    return 0;
+}
@@ -0,0 +1,66 @@
+#ifndef ARENA_H
+#define ARENA_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class Arena
+ * @brief Alocador em blocos (slab) para objetos de tamanho fixo.
+ *
+ * Os objetos são tirados de blocos grandes, em vez de uma chamada ao alocador do sistema por objeto;
+ * posições liberadas vão para uma lista livre e são reaproveitadas. Todos os blocos são devolvidos de
+ * uma vez por liberaTudo ou pelo destrutor, sem percorrer os objetos. Os objetos são construídos com
+ * new posicional sobre a memória devolvida por aloca; só devem ser guardados nela objetos cujo destrutor
+ * não libere outros recursos além de memória da própria arena.
+ */
+class Arena
+{
+public:
+    /**
+     * @brief Construtor da classe Arena.
+     * @param tamanhoObjeto Tamanho, em bytes, dos objetos alocados.
+     * @param objetosPorBloco Número de objetos em cada bloco.
+     */
+    Arena(std::size_t tamanhoObjeto, int objetosPorBloco = 4096);
+
+    /**
+     * @brief Destrutor; devolve todos os blocos ao sistema.
+     */
+    ~Arena();
+
+    /**
+     * @brief Obtém memória para um objeto.
+     * @return Ponteiro alinhado para uma posição livre.
+     */
+    void *aloca();
+
+    /**
+     * @brief Devolve a posição de um objeto (já destruído) para reaproveitamento.
+     * @param objeto Ponteiro obtido de aloca.
+     */
+    void libera(void *objeto);
+
+    /**
+     * @brief Libera todos os objetos de uma vez, devolvendo os blocos ao sistema.
+     */
+    void liberaTudo();
+
+    /**
+     * @brief Obtém o número de blocos alocados.
+     * @return Quantidade de blocos.
+     */
+    int getNumBlocos() const;
+
+private:
+    std::size_t tamanho;      ///< Tamanho de cada posição (arredondado para o alinhamento).
+    int porBloco;             ///< Número de posições por bloco.
+    int usadasNoBloco;        ///< Posições já entregues do último bloco.
+    std::vector<char *> blocos; ///< Blocos alocados.
+    void *livres;             ///< Lista livre encadeada pelas próprias posições liberadas.
+
+    Arena(const Arena &) = delete;
+    Arena &operator=(const Arena &) = delete;
+};
+
+#endif // ARENA_H
@@ -0,0 +1,142 @@
+#ifndef BUSCALARGURA_H
+#define BUSCALARGURA_H
+
+#include "VisaoCSR.h"
+#include <cstdint>
+#include <vector>
+
+class Grafo;
+
+/**
+ * @class BuscaLargura
+ * @brief Busca em largura por fronteiras, com troca entre os sentidos descendente e ascendente (direction-optimizing).
+ *
+ * No sentido descendente a fronteira é uma fila circular e cada vértice dela percorre as suas arestas de saída. Quando
+ * as arestas da fronteira passam de uma fração das arestas ainda não exploradas (em grafos de diâmetro pequeno isso
+ * acontece já no segundo ou terceiro nível), a fronteira vira um mapa de bits e a busca passa a ser ascendente: cada
+ * vértice ainda não alcançado procura, entre as suas arestas de entrada, um vizinho na fronteira, e para no primeiro.
+ * Quando a fronteira volta a ficar pequena, a busca retorna ao sentido descendente.
+ *
+ * Sobre a mesma busca ficam as distâncias em número de arestas a partir de uma origem, as componentes conexas
+ * (fracamente conexas, em grafos direcionados) e a bipartição, ambas em todas as componentes. A visão do grafo vale
+ * para a versão em que foi preparada.
+ */
+class BuscaLargura
+{
+public:
+    /**
+     * @brief Construtor; cria uma busca sem grafo.
+     */
+    BuscaLargura();
+
+    /**
+     * @brief Guarda as adjacências de saída e de entrada do grafo (a de entrada vem de Grafo::transposta).
+     * @param grafo Grafo sobre o qual as buscas serão feitas.
+     */
+    void prepara(Grafo &grafo);
+
+    /**
+     * @brief Calcula a distância, em número de arestas, de uma origem a todos os vértices, seguindo o sentido das arestas.
+     * @param origem Índice denso do vértice de origem.
+     * @param nivel Recebe a distância de cada vértice (-1 se inalcançável ou removido).
+     * @return Número de vértices alcançados, incluindo a origem (0 se a origem for inválida).
+     */
+    int distancias(int origem, std::vector<int> &nivel);
+
+    /**
+     * @brief Identifica as componentes conexas do grafo subjacente não direcionado, com uma busca por componente.
+     * @param rotulo Recebe a componente de cada vértice, numeradas a partir de 0 (-1 para os removidos).
+     * @param tamanhos Se não for nullptr, recebe o número de vértices de cada componente.
+     * @return Número de componentes.
+     */
+    int componentes(std::vector<int> &rotulo, std::vector<int> *tamanhos = nullptr);
+
+    /**
+     * @brief Verifica se todas as componentes do grafo subjacente admitem 2-coloração. A cor de cada vértice é a
+     * paridade do seu nível na busca da sua componente; o grafo é bipartido se nenhuma aresta (nem laço) liga
+     * vértices da mesma cor.
+     * @param cor Se não for nullptr, recebe a cor (0 ou 1) de cada vértice (-1 para os removidos).
+     * @param componentesBipartidas Se não for nullptr, recebe o número de componentes bipartidas.
+     * @return true se todas as componentes forem bipartidas.
+     */
+    bool bipartido(std::vector<int> *cor = nullptr, int *componentesBipartidas = nullptr);
+
+    /**
+     * @brief Obtém o número de níveis percorridos pela última chamada.
+     * @return Níveis, somando os das buscas de todas as componentes.
+     */
+    int getNiveis() const { return niveis; }
+
+    /**
+     * @brief Obtém quantos desses níveis foram percorridos no sentido ascendente.
+     * @return Níveis ascendentes.
+     */
+    int getNiveisAscendentes() const { return niveisAscendentes; }
+
+private:
+    static const int ALFA = 14; ///< Passa a ascendente quando as arestas da fronteira superam 1/ALFA das não exploradas.
+    static const int BETA = 24; ///< Fica no sentido descendente enquanto a fronteira tem menos de 1/BETA dos vértices.
+
+    int ordem;                   ///< Número de índices do grafo na preparação.
+    int vivos;                   ///< Número de vértices não removidos.
+    bool direcionado;            ///< Indica se o grafo é direcionado.
+    std::vector<char> removido;  ///< Indica, por índice denso, os vértices removidos.
+    VisaoCSR saida;              ///< Vizinhos de saída de cada vértice.
+    VisaoCSR entrada;            ///< Vizinhos de entrada (só em grafos direcionados; nos demais, saida serve aos dois).
+    VisaoCSR simetrica;          ///< Grafo subjacente não direcionado (só em grafos direcionados, montado sob demanda).
+
+    std::vector<int> fila;           ///< Fila circular da fronteira descendente (capacidade ordem).
+    size_t inicioFila;               ///< Posição do primeiro elemento da fila.
+    size_t tamanhoFila;              ///< Número de elementos na fila.
+    std::vector<uint64_t> fronteira; ///< Mapa de bits da fronteira ascendente.
+    std::vector<uint64_t> proxima;   ///< Mapa de bits do próximo nível ascendente.
+    int niveis;                      ///< Níveis percorridos pela última chamada.
+    int niveisAscendentes;           ///< Níveis ascendentes da última chamada.
+
+    /**
+     * @brief Obtém o grafo subjacente não direcionado.
+     * @return saida, se o grafo não for direcionado; caso contrário, a versão simétrica.
+     */
+    const VisaoCSR &naoDirecionado();
+
+    /**
+     * @brief Busca a partir de uma origem, rotulando só os vértices ainda com nível -1.
+     * @param frente Adjacência seguida pela busca descendente.
+     * @param tras Adjacência invertida, percorrida pela busca ascendente.
+     * @param origem Vértice de origem (com nível -1).
+     * @param nivel Nível de cada vértice; os alcançados recebem a distância à origem.
+     * @param pendentes Soma dos graus em frente dos vértices ainda não alcançados (atualizada).
+     * @param rotulo Se não for nullptr, os vértices alcançados recebem nele o número da componente.
+     * @param componente Número gravado em rotulo.
+     * @return Número de vértices alcançados.
+     */
+    int percorre(const VisaoCSR &frente, const VisaoCSR &tras, int origem, std::vector<int> &nivel, long long &pendentes,
+                 std::vector<int> *rotulo, int componente);
+
+    /**
+     * @brief Busca a partir de cada vértice ainda não alcançado do grafo subjacente, uma componente por vez.
+     * @param rotulo Recebe a componente de cada vértice (-1 para os removidos).
+     * @param nivel Recebe a distância de cada vértice à raiz da sua componente.
+     * @param tamanhos Se não for nullptr, recebe o número de vértices de cada componente.
+     * @return Número de componentes.
+     */
+    int rotulaComponentes(std::vector<int> &rotulo, std::vector<int> &nivel, std::vector<int> *tamanhos);
+
+    /**
+     * @brief Insere um vértice no fim da fila circular.
+     * @param v Vértice.
+     */
+    void enfileira(int v)
+    {
+        size_t fim = inicioFila + tamanhoFila++;
+        fila[fim < fila.size() ? fim : fim - fila.size()] = v;
+    }
+
+    /**
+     * @brief Remove o vértice do início da fila circular.
+     * @return O vértice removido.
+     */
+    int desenfileira();
+};
+
+#endif // BUSCALARGURA_H
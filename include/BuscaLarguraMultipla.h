@@ -0,0 +1,99 @@
+#ifndef BUSCALARGURAMULTIPLA_H
+#define BUSCALARGURAMULTIPLA_H
+
+#include "VisaoCSR.h"
+#include <vector>
+
+class Grafo;
+
+/**
+ * @class BuscaLarguraMultipla
+ * @brief Buscas em largura simultâneas (MS-BFS) para distâncias em número de arestas: excentricidades,
+ * proximidade e diâmetro.
+ *
+ * Até LARGURA buscas avançam juntas, uma por bit: cada vértice guarda uma máscara das buscas que já o alcançaram e
+ * outra das que o têm na fronteira, e uma aresta u -> w propaga de uma vez todas as buscas de u que ainda não
+ * chegaram a w. Cada aresta é percorrida uma vez por nível para todo o lote, em vez de uma vez por busca.
+ *
+ * As distâncias ignoram os pesos; em grafos direcionados seguem o sentido das arestas. A excentricidade de um
+ * vértice é a maior distância até os vértices que ele alcança, e o diâmetro é a maior dessas distâncias finitas.
+ * A visão do grafo vale para a versão em que foi preparada.
+ */
+class BuscaLarguraMultipla
+{
+public:
+    static const int LARGURA = 64; ///< Número de buscas por lote (bits de uma máscara).
+
+    /**
+     * @brief Construtor; cria uma busca sem grafo.
+     */
+    BuscaLarguraMultipla();
+
+    /**
+     * @brief Guarda a adjacência de saída do grafo.
+     * @param grafo Grafo sobre o qual as buscas serão feitas.
+     */
+    void prepara(Grafo &grafo);
+
+    /**
+     * @brief Calcula a excentricidade exata de todos os vértices com uma busca por vértice, em lotes de LARGURA
+     * buscas divididos entre threads.
+     * @param excentricidade Recebe a excentricidade de cada índice denso (-1 para os removidos).
+     * @param proximidade Se não for nullptr, recebe a proximidade de cada vértice: (r - 1) / soma das distâncias,
+     * multiplicada por (r - 1) / (n - 1), com r os vértices alcançados (incluindo o próprio) e n os vértices do grafo,
+     * o que a mantém comparável em grafos desconexos (0 se o vértice não alcança nenhum outro).
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     */
+    void excentricidades(std::vector<int> &excentricidade, std::vector<double> *proximidade = nullptr, int numThreads = 0);
+
+    /**
+     * @brief Calcula o diâmetro sem a excentricidade de todos os vértices (iFUB).
+     *
+     * Em cada componente, duas buscas (dupla varredura) dão um limite inferior e um vértice central u, no meio do
+     * caminho mais longo encontrado. Os vértices são então tratados por nível da busca a partir de u, do mais
+     * distante para o mais próximo, com as excentricidades de cada nível calculadas em lotes; como dois vértices até
+     * o nível i estão a no máximo 2i arestas, o cálculo para quando o limite inferior chega a 2i. Em grafos
+     * direcionados esse limite não vale, e o diâmetro vem das excentricidades de todos os vértices.
+     * @param numThreads Número de threads dos lotes (0 usa todos os núcleos).
+     * @return O diâmetro (0 se não houver arestas).
+     */
+    int diametro(int numThreads = 0);
+
+    /**
+     * @brief Obtém o número de buscas feitas pela última chamada a excentricidades ou diametro.
+     * @return Número de buscas (cada origem de um lote conta como uma).
+     */
+    long long getNumBuscas() const { return numBuscas; }
+
+private:
+    int ordem;                 ///< Número de índices do grafo na preparação.
+    int vivos;                 ///< Número de vértices não removidos.
+    bool direcionado;          ///< Indica se o grafo é direcionado.
+    VisaoCSR adjacencia;       ///< Vizinhos de saída de cada vértice.
+    std::vector<char> removido; ///< Indica, por índice denso, os vértices removidos.
+    long long numBuscas;       ///< Buscas feitas pela última chamada.
+
+    /**
+     * @brief Calcula as excentricidades de uma lista de vértices, em lotes divididos entre threads.
+     * @param origens Vértices de origem.
+     * @param excentricidade Recebe a excentricidade de cada origem, na ordem da lista.
+     * @param somaDistancias Se não for nullptr, recebe a soma das distâncias a partir de cada origem.
+     * @param alcance Se não for nullptr, recebe o número de vértices alcançados por cada origem (incluindo ela).
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     */
+    void calculaLotes(const std::vector<int> &origens, std::vector<int> &excentricidade, std::vector<long long> *somaDistancias,
+                      std::vector<int> *alcance, int numThreads);
+
+    /**
+     * @brief Busca em largura simples a partir de uma origem, sem percorrer os vértices que ela não alcança.
+     * @param origem Vértice de origem.
+     * @param nivel Vetor com ordem posições; recebe a distância de cada vértice alcançado. As posições dos vértices
+     * em visitados (da busca anterior) voltam a -1 antes da busca.
+     * @param visitados Recebe os vértices alcançados, em ordem de distância.
+     * @param anterior Se não for nullptr, recebe o predecessor de cada vértice alcançado (-1 para a origem).
+     * @return O último vértice alcançado (um dos mais distantes).
+     */
+    int buscaSimples(int origem, std::vector<int> &nivel, std::vector<int> &visitados, std::vector<int> *anterior);
+};
+
+#endif // BUSCALARGURAMULTIPLA_H
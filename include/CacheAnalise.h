@@ -0,0 +1,92 @@
+#ifndef CACHEANALISE_H
+#define CACHEANALISE_H
+
+#include "VisaoCSR.h"
+#include <map>
+#include <string>
+#include <vector>
+
+/**
+ * @class CacheAnalise
+ * @brief Cache persistente em disco de resultados de análises, indexado pela impressão digital do grafo.
+ *
+ * Cada grafo tem um arquivo `<impressao>.cache` no diretório de cache, com uma linha `chave=valor`
+ * por resultado. As chaves levam a representação que calculou o resultado (`matriz` ou `lista`), pois
+ * heurísticas como as coberturas podem responder de forma diferente em cada uma; o cabeçalho do arquivo
+ * traz a versão das análises, e arquivos de outra versão são descartados. O diretório padrão é `.cache_grafos` e pode ser trocado pela variável de ambiente
+ * `GRAFO_CACHE_DIR`; definir `GRAFO_SEM_CACHE` desativa o cache.
+ */
+class CacheAnalise
+{
+private:
+    std::string caminho;                           ///< Caminho do arquivo de cache deste grafo.
+    std::map<std::string, std::string> entradas;   ///< Resultados já conhecidos, com a representação na chave.
+    std::string representacao;                     ///< Representação do grafo que usa o cache.
+    bool ativo;                                    ///< Indica se o cache está em uso.
+
+    /**
+     * @brief Regrava o arquivo de cache com todas as entradas.
+     */
+    void salva();
+
+public:
+    /**
+     * @brief Abre o cache associado a uma impressão digital, carregando as entradas existentes.
+     * @param impressao Impressão digital do grafo.
+     * @param representacao Representação do grafo (por exemplo, "matriz" ou "lista"); só são vistos os
+     * resultados gravados pela mesma representação.
+     * @param ativo Permite desativar o cache (por exemplo, quando o grafo foi alterado após a carga).
+     */
+    CacheAnalise(unsigned long long impressao, const std::string &representacao, bool ativo = true);
+
+    /**
+     * @brief Indica se o cache está em uso.
+     * @return true se o cache está ativo, false caso contrário.
+     */
+    bool estaAtivo() const { return ativo; }
+
+    /**
+     * @brief Busca um resultado no cache.
+     * @param chave Nome do resultado.
+     * @param valor Recebe o valor armazenado, se existir.
+     * @return true se o resultado estava no cache, false caso contrário.
+     */
+    bool obtem(const std::string &chave, std::string &valor) const;
+
+    /**
+     * @brief Armazena um resultado no cache e o persiste em disco.
+     * @param chave Nome do resultado (sem '=' nem quebras de linha).
+     * @param valor Valor a armazenar (sem quebras de linha).
+     */
+    void grava(const std::string &chave, const std::string &valor);
+
+    /**
+     * @brief Calcula a impressão digital de um grafo a partir do cabeçalho, dos pesos dos vértices e da adjacência ordenada.
+     * @param direcionado Indica se o grafo é direcionado.
+     * @param ponderadoVertices Indica se os vértices possuem pesos.
+     * @param ponderadoArestas Indica se as arestas possuem pesos.
+     * @param pesosVertices Pesos dos vértices (vazio se não ponderado).
+     * @param adjacencia Adjacência ordenada e sem repetições.
+     * @return Hash de 64 bits do conteúdo do grafo.
+     */
+    static unsigned long long calculaImpressao(bool direcionado, bool ponderadoVertices, bool ponderadoArestas,
+                                               const std::vector<float> &pesosVertices, const VisaoCSR &adjacencia);
+
+    /**
+     * @brief Obtém o caminho de um arquivo do diretório de cache associado a uma impressão digital,
+     * criando o diretório se necessário. Usado também pelos índices gravados em formato binário.
+     * @param impressao Impressão digital do grafo.
+     * @param extensao Extensão do arquivo (por exemplo, ".cache").
+     * @return Caminho do arquivo, ou vazio se o cache estiver desativado ou o diretório não puder ser criado.
+     */
+    static std::string caminhoArquivo(unsigned long long impressao, const std::string &extensao);
+
+    /**
+     * @brief Converte uma impressão digital para texto hexadecimal.
+     * @param impressao Impressão digital.
+     * @return Representação hexadecimal com 16 dígitos.
+     */
+    static std::string impressaoHex(unsigned long long impressao);
+};
+
+#endif // CACHEANALISE_H
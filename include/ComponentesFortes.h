@@ -0,0 +1,85 @@
+#ifndef COMPONENTESFORTES_H
+#define COMPONENTESFORTES_H
+
+#include "VisaoCSR.h"
+#include <vector>
+
+class Grafo;
+
+/**
+ * @class ComponentesFortes
+ * @brief Componentes fortemente conexas: Tarjan iterativo e uma versão paralela por buscas nos dois sentidos e
+ * coloração.
+ *
+ * Tarjan percorre o grafo em profundidade com pilhas explícitas, sem recursão. A versão paralela segue o esquema
+ * Multistep: primeiro retira os vértices sem arcos de entrada ou de saída (componentes unitárias); depois busca para a
+ * frente e para trás a partir de um pivô de grau alto, e a interseção das duas buscas é a componente do pivô, em geral
+ * a gigante; o restante é resolvido por coloração: cada vértice propaga o maior índice que o alcança, e os vértices de
+ * cor r que alcançam r, dentro da cor r, formam a componente de r.
+ *
+ * Em grafos não direcionados as componentes fortes coincidem com as conexas. A visão do grafo vale para a versão em
+ * que foi preparada.
+ */
+class ComponentesFortes
+{
+public:
+    /**
+     * @brief Construtor; cria um cálculo sem grafo.
+     */
+    ComponentesFortes();
+
+    /**
+     * @brief Guarda a adjacência de saída do grafo.
+     * @param grafo Grafo cujas componentes serão calculadas.
+     */
+    void prepara(Grafo &grafo);
+
+    /**
+     * @brief Calcula as componentes com o algoritmo de Tarjan iterativo, em uma única thread.
+     * @param rotulo Recebe a componente de cada índice denso, numeradas na ordem do menor índice de cada uma (-1
+     * para os removidos).
+     * @return Número de componentes.
+     */
+    int tarjan(std::vector<int> &rotulo);
+
+    /**
+     * @brief Calcula as componentes em paralelo (poda, busca nos dois sentidos a partir de um pivô e coloração).
+     * @param rotulo Recebe a componente de cada índice denso, com a mesma numeração de tarjan.
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     * @return Número de componentes.
+     */
+    int paralelo(std::vector<int> &rotulo, int numThreads = 0);
+
+    /**
+     * @brief Monta o grafo de condensação: um vértice por componente e um arco entre duas componentes quando algum
+     * arco do grafo liga a primeira à segunda. O resultado é acíclico.
+     * @param rotulo Componente de cada vértice, como devolvida por tarjan ou paralelo.
+     * @param numComponentes Número de componentes.
+     * @param dag Recebe a condensação; o peso de cada arco é o menor peso entre os arcos que ele representa.
+     */
+    void condensacao(const std::vector<int> &rotulo, int numComponentes, VisaoCSR &dag) const;
+
+private:
+    Grafo *grafo;               ///< Grafo da preparação (fornece a transposta).
+    int ordem;                  ///< Número de índices do grafo na preparação.
+    bool direcionado;           ///< Indica se o grafo é direcionado.
+    std::vector<char> removido; ///< Indica, por índice denso, os vértices removidos.
+    VisaoCSR saida;             ///< Vizinhos de saída de cada vértice.
+    VisaoCSR entrada;           ///< Vizinhos de entrada (só em grafos direcionados, obtida sob demanda).
+
+    /**
+     * @brief Obtém a adjacência de entrada.
+     * @return saida, se o grafo não for direcionado; caso contrário, a transposta guardada no grafo
+     * (Grafo::transposta), que a monta só na primeira vez em cada versão.
+     */
+    const VisaoCSR &transposta();
+
+    /**
+     * @brief Renumera os rótulos na ordem do menor índice de cada componente.
+     * @param rotulo Rótulos quaisquer em [0, ordem) (-1 para os removidos), substituídos pelos números finais.
+     * @return Número de componentes.
+     */
+    int renumera(std::vector<int> &rotulo) const;
+};
+
+#endif // COMPONENTESFORTES_H
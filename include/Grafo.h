@@ -3,6 +3,12 @@
 
 #include "No.h"
 #include "Aresta.h"
+#include "Importador.h"
+#include "VisaoCSR.h"
+#include "PerfilGrafo.h"
+#include "MatrizDistancias.h"
+#include "Heuristica.h"
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -21,8 +27,36 @@ protected:
     bool direcionado;       ///< Indica se o grafo é direcionado (true) ou não (false).
     bool ponderadoVertices; ///< Indica se os vértices possuem pesos (true) ou não (false).
     bool ponderadoArestas;  ///< Indica se as arestas possuem pesos (true) ou não (false).
+    Arena arenaNos;         ///< Arena dos nós da lista de nós (liberada de uma vez na destruição ou recarga).
+    Arena arenaArestas;     ///< Arena das arestas dos nós.
     No *primeiroNo;         ///< Ponteiro para o primeiro nó da lista de nós.
     No *ultimoNo;           ///< Ponteiro para o último nó da lista de nós.
+    std::vector<No *> nos;  ///< Índice denso ID -> nó (não possui os nós, que pertencem à lista de nós).
+    MapaIds ids;            ///< Correspondência entre os IDs externos (do arquivo) e os índices densos.
+    std::vector<char> removidos; ///< Marca (lápide) dos vértices removidos e ainda não compactados.
+    int numRemovidos;       ///< Número de vértices marcados como removidos.
+    std::vector<std::vector<int>> predecessores; ///< Vértices com arco para cada vértice (só em grafos direcionados).
+    unsigned long long impressaoDigital; ///< Hash do conteúdo do grafo calculado na carga.
+    bool impressaoValida;   ///< Indica se o grafo não foi alterado desde a carga (impressão ainda corresponde ao conteúdo).
+    unsigned long versao;   ///< Versão do conteúdo; incrementada a cada carga ou alteração.
+    int numArestas;         ///< Número de arestas (cada aresta não direcionada conta uma vez).
+    int numLacos;           ///< Número de laços (arestas de um vértice para ele mesmo).
+    // Atributos dos vértices em vetores paralelos (estrutura de vetores), indexados pelo índice denso:
+    // varreduras por peso ou grau leem só o vetor correspondente, sem percorrer os objetos No.
+    std::vector<float> pesosNos;              ///< Peso de cada vértice.
+    std::vector<unsigned int> grausSaida;     ///< Grau de saída de cada vértice, mantido a cada alteração.
+    std::vector<unsigned int> grausEntrada;   ///< Grau de entrada de cada vértice (igual ao de saída se não direcionado).
+    PerfilGrafo perfilCache; ///< Perfil calculado na versão versaoPerfil.
+    unsigned long versaoPerfil; ///< Versão em que o perfil foi calculado (0 se nunca foi).
+    VisaoCSR transpostaCache;   ///< Arcos de entrada de cada vértice na versão versaoTransposta.
+    unsigned long versaoTransposta; ///< Versão em que a transposta foi montada (0 se nunca foi).
+    bool pesosInteirosCache;    ///< Resultado de pesosInteiros na versão versaoPesos.
+    bool pesosNegativosCache;   ///< Resultado de pesosNegativos na versão versaoPesos.
+    unsigned long versaoPesos;  ///< Versão em que os pesos foram classificados (0 se nunca foram).
+    std::vector<double> potenciais; ///< Potenciais de Johnson (distâncias a partir de uma fonte virtual) na versão versaoPotenciais.
+    bool cicloNegativo;         ///< Indica se o cálculo dos potenciais encontrou um ciclo de custo negativo.
+    unsigned long versaoPotenciais; ///< Versão em que os potenciais foram calculados (0 se nunca foram).
+    int verticesVisitados;      ///< Vértices fechados pela última busca de caminho mínimo.
 
     /**
      * @brief Constrói uma solução inicial para o problema de cobertura de arestas usando um método guloso randomizado.
@@ -62,6 +96,164 @@ protected:
                                         float *valores, int *contadores,
                                         int tamanhoLista, float melhorValor) = 0;
 
+    /**
+     * @brief Constrói a estrutura de adjacência específica do backend a partir da visão CSR.
+     * Chamada por constroiGrafo depois que os nós (e suas arestas) já foram criados e indexados em nos.
+     * @param adjacencia Adjacência ordenada e sem repetições.
+     */
+    virtual void constroiEstrutura(const VisaoCSR &adjacencia) = 0;
+
+    /**
+     * @brief Cria a lista de nós do grafo, com seus pesos e arestas, e o índice nos, em lote.
+     * @param adjacencia Adjacência ordenada e sem repetições.
+     * @param pesosVertices Pesos dos vértices (vazio se não ponderado).
+     */
+    void constroiNos(const VisaoCSR &adjacencia, const std::vector<float> &pesosVertices);
+
+    /**
+     * @brief Cria um nó no fim da lista de nós, com o próximo ID livre, e o registra no índice.
+     * @param peso Peso do novo nó.
+     * @return Ponteiro para o nó criado.
+     */
+    No *anexaNo(float peso);
+
+    /**
+     * @brief Marca um nó como removido (lápide), retirando as arestas incidentes em O(grau).
+     * O nó continua ocupando seu índice, sem arestas, até a próxima compactação.
+     * @param id Índice do nó.
+     * @param saida Recebe os vizinhos de saída que o nó tinha.
+     * @param entrada Recebe os vértices com arco para o nó (vazio se o grafo não for direcionado).
+     */
+    void marcaRemovido(int id, std::vector<int> &saida, std::vector<int> &entrada);
+
+    /**
+     * @brief Compacta o grafo se a fração de vértices removidos passou do limite.
+     * Deve ser chamada pelos backends ao final de deleta_no.
+     */
+    void compactaSeNecessario();
+
+    /**
+     * @brief Renumera a estrutura de adjacência do backend, descartando os vértices removidos.
+     * Chamada por compacta antes de a classe base renumerar os nós.
+     * @param novoIndice Novo índice de cada vértice (-1 para os removidos).
+     * @param novaOrdem Número de vértices que permanecem.
+     */
+    virtual void compactaEstrutura(const std::vector<int> &novoIndice, int novaOrdem) = 0;
+
+    /**
+     * @brief Insere a aresta origem -> destino nas listas de arestas dos nós e atualiza os contadores.
+     * Se o grafo não for direcionado, a aresta é registrada nos dois sentidos.
+     * @param origem ID do vértice de origem.
+     * @param destino ID do vértice de destino.
+     * @param peso Peso da aresta.
+     */
+    void ligaNos(int origem, int destino, float peso);
+
+    /**
+     * @brief Remove a aresta origem -> destino das listas de arestas dos nós e atualiza os contadores.
+     * @param origem ID do vértice de origem.
+     * @param destino ID do vértice de destino.
+     */
+    void desligaNos(int origem, int destino);
+
+    /**
+     * @brief Libera todos os nós (e suas arestas) da lista de nós.
+     */
+    void liberaNos();
+
+    /**
+     * @brief Registra que o grafo foi alterado após a carga.
+     * Deve ser chamada por toda operação que modifica vértices ou arestas; invalida as propriedades em cache.
+     */
+    void registraAlteracao();
+
+    /**
+     * @brief Atualiza os contadores de arestas e graus após inserir ou remover uma aresta.
+     * @param origem ID do vértice de origem.
+     * @param destino ID do vértice de destino.
+     * @param delta 1 para inserção, -1 para remoção.
+     */
+    void contaAresta(int origem, int destino, int delta);
+
+    /**
+     * @brief Recalcula os contadores de arestas e graus a partir de uma visão da adjacência.
+     * Usada na construção e após operações que renumeram ou criam vértices.
+     * @param adjacencia Adjacência atual do grafo.
+     */
+    void recontaArestas(const VisaoCSR &adjacencia);
+
+    /**
+     * @brief Aplica um lote de arestas à estrutura de adjacência do backend.
+     * Chamada pelas operações em lote depois de validado o lote e atualizada a lista de nós.
+     * @param lote Arestas agrupadas por origem e ordenadas por destino (nos dois sentidos, se não direcionado).
+     * @param remocao true para remover as arestas, false para inseri-las (substituindo o peso das existentes).
+     */
+    virtual void aplicaLote(const VisaoCSR &lote, bool remocao) = 0;
+
+    /**
+     * @brief Garante espaço na estrutura do backend para uma nova quantidade de índices.
+     * O crescimento é geométrico, de modo que inserções sucessivas de nós custam O(1) amortizado.
+     * @param novaOrdem Número de índices que a estrutura deve comportar.
+     */
+    virtual void reservaNos(int novaOrdem) = 0;
+
+    /**
+     * @brief Valida um lote de arestas e o organiza por origem.
+     * @param arestas Arestas com índices densos.
+     * @param quantidade Número de arestas.
+     * @param lote Visão CSR do lote (nos dois sentidos, se não direcionado), sem repetições.
+     * @return true se todas as arestas ligam vértices válidos.
+     */
+    bool preparaLote(const ArestaLida *arestas, int quantidade, VisaoCSR &lote);
+
+    /**
+     * @brief Conclui todasDistancias: fecha a matriz de custos por Floyd–Warshall e soma o peso de cada origem.
+     * A matriz deve chegar com 0 na diagonal e, em (u, v), o peso da aresta mais o peso de v.
+     * @param distancias Matriz de custos iniciais, substituída pelas distâncias.
+     * @param numThreads Número de threads do Floyd–Warshall (0 usa todos os núcleos).
+     */
+    void fechaDistancias(MatrizDistancias &distancias, int numThreads);
+
+    /**
+     * @brief Classifica os pesos de arestas e vértices (inteiros, negativos) em uma passada.
+     * O resultado é guardado e só recalculado quando o grafo muda.
+     */
+    void classificaPesos();
+
+    /**
+     * @brief Verifica se todos os pesos de arestas e vértices são inteiros (em módulo menores que 2^32).
+     * Decide a fila usada por menorDistancia.
+     * @return true se as distâncias podem ser tratadas como inteiros.
+     */
+    bool pesosInteiros();
+
+    /**
+     * @brief Verifica se há aresta ou vértice com peso negativo.
+     * @return true se algum peso for negativo (o Dijkstra direto não vale).
+     */
+    bool pesosNegativos();
+
+    /**
+     * @brief Calcula (ou reaproveita) os potenciais de Johnson: a distância de cada vértice a partir de uma
+     * fonte virtual ligada a todos com custo 0. Com eles, o custo reduzido w(u, v) + peso(v) + h(u) - h(v)
+     * de toda aresta é não negativo e o Dijkstra volta a valer.
+     * @return false se o grafo tiver um ciclo de custo negativo.
+     */
+    bool calculaPotenciais();
+
+    /**
+     * @brief Relaxa distâncias por Bellman-Ford a partir dos vértices com distância finita.
+     *
+     * Em grafos pequenos usa a versão com fila (SPFA), que só reexamina vértices cuja distância mudou. Em grafos
+     * grandes, com mais de uma thread, faz rodadas completas em que cada vértice recalcula a distância a partir
+     * das arestas de entrada e da rodada anterior; as faixas de vértices são divididas entre as threads.
+     * @param distancia Distâncias iniciais (infinito para os vértices que não são fonte); recebe as finais.
+     * @param anterior Recebe o predecessor de cada vértice (-1 se não houver).
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     * @return false se houver ciclo de custo negativo alcançável a partir das fontes.
+     */
+    bool relaxaBellmanFord(std::vector<double> &distancia, std::vector<int> &anterior, int numThreads);
+
 public:
     /**
      * @brief Construtor da classe Grafo.
@@ -80,7 +272,10 @@ public:
      *
      * Inicializa um grafo vazio com valores padrão (ordem = 0, não direcionado, sem pesos).
      */
-    Grafo() : ordem(0), numNos(0), direcionado(false), ponderadoVertices(false), ponderadoArestas(false) {}
+    Grafo() : ordem(0), numNos(0), direcionado(false), ponderadoVertices(false), ponderadoArestas(false),
+              arenaNos(sizeof(No)), arenaArestas(sizeof(Aresta)), primeiroNo(nullptr), ultimoNo(nullptr), numRemovidos(0), impressaoDigital(0), impressaoValida(false),
+              versao(1), numArestas(0), numLacos(0), versaoPerfil(0), versaoTransposta(0), pesosInteirosCache(false), pesosNegativosCache(false), versaoPesos(0),
+              cicloNegativo(false), versaoPotenciais(0), verticesVisitados(0) {}
 
     /**
      * @brief Destrutor virtual da classe Grafo.
@@ -97,21 +292,30 @@ public:
     virtual int *construcaoGulosa(int *tamanhoCobertura) = 0;
 
     /**
-     * @brief Remove um nó do grafo.
-     * @param idNo ID do nó a ser removido.
+     * @brief Remove um nó do grafo em O(grau), marcando-o como removido.
+     * Os índices dos demais nós não mudam até a compactação, que ocorre automaticamente quando
+     * a fração de removidos passa do limite ou explicitamente por compacta().
+     * @param idNo Índice denso do nó a ser removido (use getIndice para converter um ID externo).
      */
     virtual void deleta_no(int idNo) = 0;
 
     /**
-     * @brief Obtém o grau de um vértice.
+     * @brief Obtém o grau de um vértice em tempo constante.
      * @param vertice Índice do vértice.
-     * @return Número de arestas conectadas ao vértice especificado.
+     * @return Número de arestas conectadas ao vértice especificado, ou -1 se o vértice não existir.
      */
     virtual int getGrau(int vertice);
 
+    /**
+     * @brief Obtém o grau de entrada de um vértice em tempo constante.
+     * @param vertice Índice do vértice.
+     * @return Número de arcos que chegam ao vértice (igual a getGrau se não direcionado), ou -1 se o vértice não existir.
+     */
+    virtual int getGrauEntrada(int vertice);
+
     /**
      * @brief Obtém a ordem do grafo.
-     * @return A ordem (número de vértices) do grafo.
+     * @return A ordem (número de vértices não removidos) do grafo.
      */
     virtual int getOrdem();
 
@@ -121,6 +325,61 @@ public:
      */
     virtual int getNumNos();
 
+    /**
+     * @brief Obtém o ID externo (como no arquivo de entrada) de um vértice.
+     * Os algoritmos trabalham com índices densos; este ID é o usado para exibir resultados.
+     * @param indice Índice denso do vértice.
+     * @return ID externo do vértice.
+     */
+    long long getIdExterno(int indice);
+
+    /**
+     * @brief Obtém o índice denso de um vértice a partir do seu ID externo.
+     * @param idExterno ID do vértice como no arquivo de entrada.
+     * @return Índice denso, ou -1 se não houver vértice com esse ID.
+     */
+    int getIndice(long long idExterno);
+
+    /**
+     * @brief Indica se um índice corresponde a um vértice removido e ainda não compactado.
+     * Laços sobre os índices 0..getNumIndices()-1 devem ignorar esses vértices.
+     * @param indice Índice denso.
+     * @return true se o vértice foi removido.
+     */
+    bool estaRemovido(int indice);
+
+    /**
+     * @brief Obtém o tamanho do espaço de índices, incluindo vértices removidos ainda não compactados.
+     * @return Número de índices.
+     */
+    int getNumIndices();
+
+    /**
+     * @brief Descarta os vértices removidos e renumera os demais em uma única passada linear.
+     * Os IDs externos são preservados; apenas os índices densos mudam.
+     */
+    void compacta();
+
+    /**
+     * @brief Obtém o número de arestas do grafo em tempo constante.
+     * @return Número de arestas (cada aresta não direcionada conta uma vez).
+     */
+    int getNumArestas();
+
+    /**
+     * @brief Obtém a versão do conteúdo do grafo.
+     * A versão muda a cada carga ou alteração; resultados calculados sobre uma versão continuam válidos enquanto ela não mudar.
+     * @return A versão atual.
+     */
+    unsigned long getVersao();
+
+    /**
+     * @brief Obtém a impressão digital do conteúdo do grafo, calculada na carga.
+     * @param impressao Recebe a impressão digital.
+     * @return true se a impressão corresponde ao conteúdo atual, false se o grafo foi alterado após a carga.
+     */
+    bool getImpressaoDigital(unsigned long long &impressao);
+
     /**
      * @brief Verifica se o grafo é direcionado.
      * @return true se o grafo for direcionado, false caso contrário.
@@ -134,14 +393,16 @@ public:
     virtual bool verticePonderado();
 
     /**
-     * @brief Verifica se o grafo possui arestas ponderadas.
-     * @return true se ao menos uma aresta for ponderada, false caso contrário.
+     * @brief Verifica se o grafo possui arestas ponderadas, conforme declarado na entrada (cabeçalho do arquivo ou
+     * presença de pesos nas linhas). Arestas sem peso são guardadas com custo 1, então o peso delas não serve de teste.
+     * @return true se as arestas forem ponderadas, false caso contrário.
      */
     virtual bool arestaPonderada();
 
     /**
      * @brief Verifica se o grafo é completo.
      * Um grafo completo possui todas as combinações possíveis de arestas entre seus vértices.
+     * Como não há arestas repetidas, basta comparar o contador de arestas com o máximo possível.
      * @return true se o grafo é completo; caso contrário, false.
      */
     virtual bool ehCompleto();
@@ -154,7 +415,7 @@ public:
     virtual bool ehBipartido();
 
     /**
-     * @brief Obtém o nó pelo seu ID.
+     * @brief Obtém o nó pelo seu ID, em tempo constante (índice denso).
      * @param id O ID do nó a ser buscado.
      * @return O ponteiro para o nó com o ID especificado ou nullptr caso o nó não seja encontrado.
      */
@@ -163,17 +424,79 @@ public:
     /**
      * @brief Determina o número de componentes conexos no grafo.
      * Um componente conexo é um subconjunto de vértices onde existe pelo menos um caminho entre cada par de vértices.
+     * Em grafos direcionados, conta as componentes fracamente conexas. O resultado vem do perfil em cache.
      * @return Número de componentes conexos no grafo.
      */
     virtual int nConexo();
 
+    /**
+     * @brief Identifica as componentes conexas (fracamente conexas, em grafos direcionados) em paralelo, sem recursão.
+     *
+     * Cada vértice aponta para um representante, e as arestas unem representantes com compare-and-swap, sempre do
+     * maior índice para o menor (union-find sem travas, no estilo Afforest). Primeiro são unidas apenas as duas
+     * primeiras arestas de cada vértice, o que já forma a componente gigante na maioria dos grafos; ela é identificada
+     * por amostragem, e na passada final os vértices que já estão nela pulam as arestas restantes.
+     * @param rotulo Recebe a componente de cada índice denso, numeradas na ordem do menor índice de cada uma (-1 para
+     * os removidos); o resultado não depende do número de threads.
+     * @param tamanhos Se não for nullptr, recebe o número de vértices de cada componente.
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     * @return Número de componentes.
+     */
+    virtual int componentesConexas(std::vector<int> &rotulo, std::vector<int> *tamanhos = nullptr, int numThreads = 0);
+
+    /**
+     * @brief Identifica as componentes fortemente conexas, seguindo o sentido dos arcos.
+     *
+     * Com uma thread, ou em grafos pequenos, usa Tarjan iterativo; nos demais casos, a versão paralela de
+     * ComponentesFortes. O número de componentes também fica no perfil (PerfilGrafo::componentesFortes).
+     * @param rotulo Recebe a componente de cada índice denso, numeradas na ordem do menor índice de cada uma (-1 para
+     * os removidos).
+     * @param condensacao Se não for nullptr, recebe o grafo acíclico das componentes (ver ComponentesFortes::condensacao).
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     * @return Número de componentes.
+     */
+    virtual int componentesFortes(std::vector<int> &rotulo, VisaoCSR *condensacao = nullptr, int numThreads = 0);
+
     /**
      * @brief Verifica se o grafo é uma árvore.
-     * Uma árvore é um grafo conexo sem ciclos.
+     * Uma árvore é um grafo conexo sem ciclos. Usa o contador de arestas e o número de componentes em cache.
      * @return true se o grafo é uma árvore; caso contrário, false.
      */
     virtual bool ehArvore();
 
+    /**
+     * @brief Obtém a adjacência atual do grafo no formato CSR (somente leitura).
+     * Os backends sobrescrevem este método para exportar diretamente a sua própria estrutura.
+     * @return Visão CSR com os vizinhos de saída de cada vértice, em ordem crescente de ID.
+     */
+    virtual VisaoCSR visaoCSR();
+
+    /**
+     * @brief Obtém os arcos de entrada de cada vértice no formato CSR (adjacência transposta), com os pesos exatos.
+     *
+     * É montada na primeira chamada e guardada junto com a versão do grafo, como o perfil: as chamadas seguintes
+     * reaproveitam a mesma visão até a próxima alteração. Em grafos não direcionados é a própria adjacência.
+     * A referência deixa de valer na próxima chamada depois de uma alteração.
+     * @return Visão CSR com os vértices de partida dos arcos que chegam a cada vértice, em ordem crescente de ID.
+     */
+    const VisaoCSR &transposta();
+
+    /**
+     * @brief Calcula o perfil estrutural do grafo em uma única passada.
+     *
+     * Uma busca em profundidade iterativa sobre o grafo subjacente não direcionado obtém, ao mesmo tempo,
+     * as componentes conexas, a bipartição de cada componente, as pontes e as articulações (lowlink de Tarjan).
+     * Número de arestas e estatísticas de grau vêm da mesma visão CSR.
+     * @return O perfil do grafo.
+     */
+    PerfilGrafo calculaPerfil();
+
+    /**
+     * @brief Obtém o perfil estrutural do grafo, recalculando-o apenas se o grafo mudou desde o último cálculo.
+     * @return Referência para o perfil da versão atual.
+     */
+    const PerfilGrafo &getPerfil();
+
     /**
      * @brief Verifica se o grafo possui pontes.
      * Uma ponte é uma aresta cuja remoção aumenta o número de componentes conexos do grafo.
@@ -190,21 +513,31 @@ public:
 
     /**
      * @brief Carrega o grafo a partir de um arquivo.
-     * O arquivo deve conter os dados do grafo, como número de nós, tipo de grafo e arestas.
+     * O formato (nativo, lista de arestas, DIMACS, METIS ou MatrixMarket) é detectado automaticamente
+     * e o grafo é construído em lote por constroiGrafo.
      * @param arquivo Caminho para o arquivo de entrada.
      */
-    virtual void carregaGrafo(const std::string &arquivo) = 0;
+    virtual void carregaGrafo(const std::string &arquivo);
+
+    /**
+     * @brief Constrói o grafo a partir de dados já lidos por um Importador.
+     *
+     * É o caminho único de construção: as arestas são ordenadas e agrupadas por vértice (CSR),
+     * os nós são criados em lote e o backend monta sua estrutura de uma só vez.
+     * @param dados Grafo lido do arquivo, com índices de vértices baseados em 0.
+     */
+    void constroiGrafo(const DadosGrafo &dados);
 
     /**
      * @brief Cria um novo grafo a partir de um arquivo de configuração.
-     * O arquivo deve conter as informações do grafo, como tipo de estrutura, número de nós e arestas.
+     * O arquivo contém a estrutura (`matriz` ou `lista`) seguida do grafo no formato nativo.
      * @param arquivoConfig Caminho para o arquivo de configuração.
      */
-    virtual void novoGrafo(const std::string &arquivoConfig) = 0;
+    virtual void novoGrafo(const std::string &arquivoConfig);
 
     /**
      * @brief Adiciona um nó ao grafo.
-     * @param idNo ID do nó a ser adicionado.
+     * @param idNo Índice denso de um nó existente (a lista de adjacência liga o novo nó a ele).
      */
     virtual void adicionaNo(int idNo) = 0;
 
@@ -217,12 +550,130 @@ public:
     virtual float getPesoAresta(int origem, int destino);
 
     /**
-     * @brief Calcula a menor distância entre dois vértices no grafo.
-     * @param origem O ID do vértice de origem.
-     * @param destino O ID do vértice de destino.
-     * @return A menor distância entre os vértices de origem e destino, ou -1 se não houver caminho.
+     * @brief Calcula a menor distância entre dois vértices por Dijkstra, parando assim que o destino é fechado.
+     *
+     * O custo de um caminho é o peso da origem mais, a cada passo, o peso da aresta e o do vértice de chegada.
+     * Com pesos inteiros a fila de prioridade é um HeapRadix; nos demais casos, um heap binário sobre distâncias
+     * reais. Se houver pesos negativos, o Dijkstra usa os custos reduzidos de Johnson (potenciais calculados uma
+     * vez por versão do grafo); se houver ciclo negativo, a consulta cai para Bellman-Ford a partir da origem.
+     * Em grafos não direcionados, uma aresta negativa já forma um ciclo negativo (ida e volta).
+     * @param origem Índice denso do vértice de origem.
+     * @param destino Índice denso do vértice de destino.
+     * @param caminho Se não for nullptr, recebe os índices dos vértices do caminho, da origem ao destino
+     * (vazio se não houver caminho).
+     * @return A menor distância entre os vértices de origem e destino, ou infinito se não houver caminho,
+     * algum dos índices for inválido ou um ciclo negativo alcançável pela origem tornar a distância indefinida.
+     */
+    virtual double menorDistancia(int origem, int destino, std::vector<int> *caminho = nullptr);
+
+    /**
+     * @brief Busca bidirecional: Dijkstra a partir da origem e, pelas arestas invertidas, a partir do destino,
+     * alternando o lado de menor distância até que a soma dos dois topos alcance o melhor caminho já visto.
+     * Com pesos negativos, equivale a menorDistancia.
+     * @param origem Índice denso do vértice de origem.
+     * @param destino Índice denso do vértice de destino.
+     * @param caminho Se não for nullptr, recebe os vértices do caminho (vazio se não houver).
+     * @return A menor distância, ou infinito se não houver caminho ou algum índice for inválido.
+     */
+    virtual double menorDistanciaBidirecional(int origem, int destino, std::vector<int> *caminho = nullptr);
+
+    /**
+     * @brief Busca A*: Dijkstra ordenado pelo custo conhecido mais a estimativa da heurística até o destino.
+     * A heurística deve ser consistente (ver Heuristica); HeuristicaALT é uma delas. Com pesos negativos,
+     * equivale a menorDistancia.
+     * @param origem Índice denso do vértice de origem.
+     * @param destino Índice denso do vértice de destino.
+     * @param heuristica Estimativa do custo restante.
+     * @param caminho Se não for nullptr, recebe os vértices do caminho (vazio se não houver).
+     * @return A menor distância, ou infinito se não houver caminho ou algum índice for inválido.
+     */
+    virtual double menorDistanciaAEstrela(int origem, int destino, const Heuristica &heuristica, std::vector<int> *caminho = nullptr);
+
+    /**
+     * @brief Calcula por Dijkstra as distâncias de uma origem a todos os vértices ou, com reverso, de todos até ela.
+     * @param origem Índice denso do vértice de origem (ou de chegada, com reverso).
+     * @param distancias Recebe o custo de cada caminho (infinito se não houver), com o mesmo custo de menorDistancia.
+     * @param reverso Se true, distancias[v] é o custo de v até a origem.
+     * @return false se a origem for inválida ou houver peso negativo.
+     */
+    virtual bool distanciasDijkstra(int origem, std::vector<double> &distancias, bool reverso = false);
+
+    /**
+     * @brief Recebe as linhas de distanciasLote: posição da origem na lista, a origem e as distâncias a partir
+     * dela (válidas só durante a chamada). As chamadas nunca são simultâneas, mas a ordem é a de conclusão.
+     */
+    typedef std::function<void(int, int, const std::vector<double> &)> ConsumidorDistancias;
+
+    /**
+     * @brief Calcula as distâncias de cada origem de uma lista a todos os vértices, com um Dijkstra por origem.
+     *
+     * A adjacência CSR, com o custo de cada arco já somado ao peso do vértice de chegada, é montada uma só vez para
+     * o lote, assim como a classificação dos pesos e, com pesos negativos, os potenciais de Johnson. As origens são
+     * distribuídas entre as threads, e cada thread reaproveita a fila e o vetor de distâncias de uma origem para a
+     * seguinte. Cada linha tem getNumIndices posições, com o mesmo custo de menorDistancia
+     * (infinito para os vértices inalcançáveis e os removidos).
+     * @param origens Índices densos das origens (podem se repetir).
+     * @param consumidor Função que recebe cada linha assim que fica pronta.
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     * @return false se alguma origem for inválida ou houver ciclo de custo negativo; nesse caso nenhuma linha é entregue.
+     */
+    virtual bool distanciasLote(const std::vector<int> &origens, const ConsumidorDistancias &consumidor, int numThreads = 0);
+
+    /**
+     * @brief Calcula as distâncias de um lote de origens, como a outra versão, gravando as linhas em um arquivo binário.
+     *
+     * O arquivo tem um cabeçalho de 64 bytes (assinatura "GRLOTE01", número de origens e número de índices, em
+     * inteiros de 32 bits), a lista de origens e uma linha de floats por origem, na ordem da lista. Cada linha é
+     * gravada na sua posição assim que fica pronta, sem guardar o lote inteiro na memória.
+     * @param origens Índices densos das origens.
+     * @param arquivo Caminho do arquivo.
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     * @return false se alguma origem for inválida, houver ciclo de custo negativo ou o arquivo não puder ser gravado.
+     */
+    bool distanciasLote(const std::vector<int> &origens, const std::string &arquivo, int numThreads = 0);
+
+    /**
+     * @brief Obtém o número de vértices fechados pela última busca de caminho mínimo.
+     * @return Vértices visitados (soma dos dois lados na busca bidirecional).
      */
-    virtual int menorDistancia(int origem, int destino);
+    int getVerticesVisitados() const { return verticesVisitados; }
+
+    /**
+     * @brief Calcula as menores distâncias a partir de uma origem por Bellman-Ford, aceitando pesos negativos.
+     * @param origem Índice denso do vértice de origem.
+     * @param distancias Recebe a distância de cada vértice (infinito se inalcançável), com o mesmo custo de menorDistancia.
+     * @param anterior Se não for nullptr, recebe o predecessor de cada vértice no caminho mínimo (-1 se não houver).
+     * @param numThreads Número de threads das rodadas paralelas em grafos grandes (0 usa todos os núcleos).
+     * @return false se a origem for inválida ou houver ciclo de custo negativo alcançável a partir dela.
+     */
+    virtual bool bellmanFord(int origem, std::vector<double> &distancias, std::vector<int> *anterior = nullptr, int numThreads = 0);
+
+    /**
+     * @brief Calcula as menores distâncias a partir de uma origem por delta-stepping, em paralelo.
+     *
+     * Os vértices são agrupados em baldes de largura delta pela distância provisória. Cada balde é resolvido
+     * relaxando primeiro as arestas leves (custo até delta), que podem devolver vértices ao mesmo balde, e depois
+     * as pesadas. As relaxações de uma fronteira são divididas entre threads, com atualização atômica das
+     * distâncias. Exige custos não negativos.
+     * @param origem Índice denso do vértice de origem.
+     * @param distancias Recebe a distância de cada vértice (infinito se inalcançável), com o mesmo custo de menorDistancia.
+     * @param delta Largura dos baldes (0 ou negativo usa o custo médio das arestas).
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     * @return false se a origem for inválida ou houver peso negativo.
+     */
+    virtual bool deltaStepping(int origem, std::vector<double> &distancias, double delta = 0, int numThreads = 0);
+
+    /**
+     * @brief Calcula a menor distância entre todos os pares de vértices (Floyd–Warshall em blocos).
+     *
+     * O custo de um caminho é o mesmo de menorDistancia: peso da origem mais, a cada passo, o peso da aresta
+     * e o do vértice de chegada. A matriz é indexada pelos índices densos (getNumIndices linhas); vértices
+     * removidos e pares sem caminho ficam com MatrizDistancias::INFINITO. Com ciclos de custo negativo o
+     * resultado não tem significado.
+     * @param distancias Matriz que recebe as distâncias.
+     * @param numThreads Número de threads (0 usa todos os núcleos).
+     */
+    virtual void todasDistancias(MatrizDistancias &distancias, int numThreads = 0);
 
     /**
      * @brief Adiciona uma nova aresta ao grafo.
@@ -249,6 +700,29 @@ public:
      */
     virtual void removeAresta(int idNoOrigem, int idNoDestino, bool direcionado) = 0;
 
+    /**
+     * @brief Adiciona várias arestas de uma vez.
+     * O lote é validado uma única vez (nada é aplicado se houver vértice inválido) e aplicado em blocos
+     * ordenados por origem; arestas repetidas ou já existentes têm o peso substituído.
+     * @param arestas Arestas com índices densos.
+     * @param quantidade Número de arestas.
+     */
+    void adicionaArestas(const ArestaLida *arestas, int quantidade);
+
+    /**
+     * @brief Remove várias arestas de uma vez; arestas inexistentes são ignoradas.
+     * @param arestas Arestas com índices densos (o peso é ignorado).
+     * @param quantidade Número de arestas.
+     */
+    void removeArestas(const ArestaLida *arestas, int quantidade);
+
+    /**
+     * @brief Adiciona vários nós isolados de uma vez, aumentando a estrutura uma única vez.
+     * @param quantidade Número de nós a adicionar.
+     * @return Índice do primeiro nó adicionado (os demais são consecutivos), ou -1 se a quantidade for inválida.
+     */
+    int adicionaNos(int quantidade);
+
     /**
      * @brief Implementa uma variação reativa do algoritmo GRASP para cobertura de arestas.
      * @param maxIteracoes Número máximo de iterações do algoritmo.
@@ -18,8 +18,20 @@ class GrafoLista : public Grafo
 {
 private:
     Lista *listaAdj; ///< Lista de adjacência que armazena as conexões entre os vértices.
-    No **nos;        ///< Array de ponteiros para os nós do grafo.
-    int numArestas;  ///< Número total de arestas no grafo.
+    int capacidade;  ///< Número de listas alocadas em listaAdj (pode exceder a ordem).
+    Arena arenaEntradas; ///< Arena das entradas das listas de adjacência.
+
+    /**
+     * @brief Aloca um vetor de listas vazias que usam a arena de entradas.
+     * @param quantidade Número de listas.
+     * @return Vetor de listas (liberado com delete[]).
+     */
+    Lista *criaListas(int quantidade);
+
+    /**
+     * @brief Libera todas as listas de adjacência e a arena de entradas de uma vez.
+     */
+    void liberaListas();
 
 public:
     /**
@@ -38,63 +50,20 @@ public:
     ~GrafoLista();
 
     /**
-     * @brief Verifica se o grafo é completo.
-     * Um grafo completo possui todas as combinações possíveis de arestas entre seus vértices.
-     * @return true se o grafo é completo; caso contrário, false.
-     */
-    bool ehCompleto() override;
-
-    /**
-     * @brief Determina o número de componentes conexos no grafo.
-     * Um componente conexo é um subconjunto de vértices onde existe pelo menos um caminho entre cada par de vértices.
-     * @return Número de componentes conexos no grafo.
-     */
-    int nConexo() override;
-
-    /**
-     * @brief Verifica se o grafo é uma árvore.
-     * Um grafo é uma árvore se for conexo e não possuir ciclos (nós - 1 = número de arestas).
-     * @return true se o grafo é uma árvore; caso contrário, false.
-     */
-    bool ehArvore() override;
-
-    /**
-     * @brief Verifica se o grafo possui pontes.
-     * Uma ponte é uma aresta cuja remoção aumenta o número de componentes conexos do grafo.
-     * @return true se existe pelo menos uma ponte; caso contrário, false.
+     * @brief Exporta a lista de adjacência no formato CSR.
+     * @return Visão CSR com os vizinhos de saída de cada vértice.
      */
-    bool possuiPonte() override;
-
-    /**
-     * @brief Verifica se o grafo possui vértices de articulação.
-     * Um vértice de articulação é aquele cuja remoção aumenta o número de componentes conexos do grafo.
-     * @return true se existe pelo menos um vértice de articulação; caso contrário, false.
-     */
-    bool possuiArticulacao() override;
-
-    /**
-     * @brief Carrega o grafo a partir de um arquivo.
-     * O arquivo deve conter os dados do grafo, como número de nós, tipo de grafo e arestas.
-     * @param arquivo Caminho para o arquivo de entrada.
-     */
-    void carregaGrafo(const std::string &arquivo) override;
-
-    /**
-     * @brief Cria um novo grafo a partir de um arquivo de configuração.
-     * O arquivo deve conter as informações do grafo, como tipo de estrutura, número de nós e arestas.
-     * @param arquivoConfig Caminho para o arquivo de configuração.
-     */
-    void novoGrafo(const std::string &arquivoConfig) override;
+    VisaoCSR visaoCSR() override;
 
     /**
      * @brief Remove um nó do grafo representado por lista de adjacência.
-     * @param idNo ID do nó a ser removido (ajustado para índice zero-based).
+     * @param idNo Índice denso do nó a ser removido (use getIndice para converter um ID externo).
      */
     void deleta_no(int idNo) override;
 
     /**
      * @brief Adiciona um nó ao grafo representado por lista de adjacência.
-     * @param idNo ID do nó a ser adicionado.
+     * @param idNo Índice denso do nó ao qual o novo nó é ligado.
      */
     void adicionaNo(int idNo) override;
 
@@ -169,13 +138,6 @@ private:
      */
     int *buscaLocal(int *solucao, int tamanhoSolucao, int *tamanhoMelhorSolucao) override;
 
-    /**
-     * @brief Obtém o nó correspondente a um dado ID.
-     * @param id ID do nó a ser retornado.
-     * @return Ponteiro para o nó correspondente ao ID fornecido.
-     */
-    No *getNoPeloId(int id) { return nos[id]; }
-
     /**
      * @brief Implementa um algoritmo guloso para encontrar uma cobertura de vértices.
      * @param tamanhoCobertura Ponteiro para armazenar o tamanho da cobertura encontrada.
@@ -195,6 +157,32 @@ private:
     void atualizaProbabilidades(float *alphas, float *probabilidades,
                                 float *valores, int *contadores,
                                 int tamanhoLista, float melhorValor) override;
+
+    /**
+     * @brief Monta as listas de adjacência em lote a partir da visão CSR.
+     * @param adjacencia Adjacência ordenada e sem repetições.
+     */
+    void constroiEstrutura(const VisaoCSR &adjacencia) override;
+
+    /**
+     * @brief Renumera as listas de adjacência, descartando os vértices removidos.
+     * @param novoIndice Novo índice de cada vértice (-1 para os removidos).
+     * @param novaOrdem Número de vértices que permanecem.
+     */
+    void compactaEstrutura(const std::vector<int> &novoIndice, int novaOrdem) override;
+
+    /**
+     * @brief Reconstrói cada lista tocada pelo lote uma única vez.
+     * @param lote Arestas agrupadas por origem.
+     * @param remocao true para remover as arestas, false para inseri-las.
+     */
+    void aplicaLote(const VisaoCSR &lote, bool remocao) override;
+
+    /**
+     * @brief Aumenta o vetor de listas (dobrando a capacidade) sem copiar os nós das listas.
+     * @param novaOrdem Número de listas necessárias.
+     */
+    void reservaNos(int novaOrdem) override;
 };
 
 #endif
\ No newline at end of file
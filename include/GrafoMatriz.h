@@ -11,13 +11,21 @@
  * Esta classe herda de Grafo e implementa funcionalidades específicas para manipulação de grafos
  * representados por matrizes de adjacência, incluindo operações como verificação de propriedades,
  * manipulação de nós e arestas, e algoritmos de cobertura.
+ *
+ * As células da matriz só indicam a presença da aresta (1) ou a ausência (0); os pesos ficam apenas nas listas de
+ * arestas dos nós, de modo que arestas de peso 0 ou fracionário não se confundem com a ausência de aresta.
  */
 class GrafoMatriz : public Grafo
 {
 private:
-    int **matrizAdj;        ///< Matriz de adjacência que armazena as conexões entre os vértices.
-    No **nos;               ///< Array de ponteiros para os nós do grafo.
+    int **matrizAdj;        ///< Ponteiro para o início de cada linha da matriz de adjacência (1 se há aresta, 0 se não).
     int capacidade;         ///< Capacidade máxima da matriz de adjacência.
+    int passo;              ///< Distância, em inteiros, entre o início de linhas consecutivas (múltiplo de ALINHAMENTO_LINHA).
+    void *memoriaMatriz;    ///< Bloco alocado para a matriz (inclui a folga para o alinhamento).
+    int *dadosMatriz;       ///< Matriz inteira em um único buffer contíguo, alinhado a ALINHAMENTO_MATRIZ bytes.
+
+    static const int ALINHAMENTO_MATRIZ = 64; ///< Alinhamento, em bytes, do buffer e de cada linha.
+    static const int ALINHAMENTO_LINHA = ALINHAMENTO_MATRIZ / static_cast<int>(sizeof(int)); ///< Inteiros por bloco alinhado.
 
     /**
      * @brief Implementa uma construção gulosa randomizada para encontrar uma cobertura de vértices.
@@ -64,6 +72,51 @@ private:
                                 float *valores, int *contadores,
                                 int tamanhoLista, float melhorValor) override;
 
+    /**
+     * @brief Aloca a matriz de adjacência uma única vez e a preenche a partir da visão CSR.
+     * @param adjacencia Adjacência ordenada e sem repetições.
+     */
+    void constroiEstrutura(const VisaoCSR &adjacencia) override;
+
+    /**
+     * @brief Renumera as linhas e colunas da matriz no lugar, descartando os vértices removidos.
+     * @param novoIndice Novo índice de cada vértice (-1 para os removidos).
+     * @param novaOrdem Número de vértices que permanecem.
+     */
+    void compactaEstrutura(const std::vector<int> &novoIndice, int novaOrdem) override;
+
+    /**
+     * @brief Grava ou zera as células da matriz correspondentes ao lote.
+     * @param lote Arestas agrupadas por origem.
+     * @param remocao true para remover as arestas, false para inseri-las.
+     */
+    void aplicaLote(const VisaoCSR &lote, bool remocao) override;
+
+    /**
+     * @brief Aumenta a capacidade da matriz (no mínimo dobrando) se necessário.
+     * @param novaOrdem Número de vértices que a matriz deve comportar.
+     */
+    void reservaNos(int novaOrdem) override;
+
+    /**
+     * @brief Copia os pesos das arestas de saída de um vértice, lidos da sua lista de arestas, para um vetor denso.
+     * @param vertice Índice denso do vértice.
+     * @param pesos Vetor com ordem posições; a posição de cada vizinho recebe o peso da aresta (as demais não mudam).
+     */
+    void pesosDaLinha(int vertice, std::vector<float> &pesos) const;
+
+    /**
+     * @brief Libera a matriz de adjacência.
+     */
+    void liberaMatriz();
+
+    /**
+     * @brief Realoca a matriz com uma nova capacidade em uma única alocação, preservando as células atuais.
+     * As linhas ficam contíguas, com o passo arredondado para o alinhamento, e as células novas zeradas.
+     * @param novaCapacidade Número de linhas e colunas da nova matriz.
+     */
+    void realocaMatriz(int novaCapacidade);
+
 public:
     /**
      * @brief Construtor da classe GrafoMatriz.
@@ -82,44 +135,23 @@ public:
 
     /**
      * @brief Remove um nó do grafo representado por matriz de adjacência.
-     * @param idNo ID do nó a ser removido.
+     * @param idNo Índice denso do nó a ser removido (use getIndice para converter um ID externo).
      */
     void deleta_no(int idNo) override;
 
     /**
-     * @brief Verifica se o grafo é completo.
-     * Um grafo completo possui todas as combinações possíveis de arestas entre seus vértices.
-     * @return true se o grafo é completo; caso contrário, false.
-     */
-    bool ehCompleto() override;
-
-    /**
-     * @brief Determina o número de componentes conexos no grafo.
-     * Um componente conexo é um subconjunto de vértices onde existe pelo menos um caminho entre cada par de vértices.
-     * @return Número de componentes conexos no grafo.
-     */
-    int nConexo() override;
-
-    /**
-     * @brief Verifica se o grafo é uma árvore.
-     * Uma árvore é um grafo conexo sem ciclos.
-     * @return true se o grafo é uma árvore; caso contrário, false.
+     * @brief Exporta a matriz de adjacência no formato CSR.
+     * @return Visão CSR com os vizinhos de saída de cada vértice.
      */
-    bool ehArvore() override;
+    VisaoCSR visaoCSR() override;
 
     /**
-     * @brief Verifica se o grafo possui pontes.
-     * Uma ponte é uma aresta cuja remoção aumenta o número de componentes conexos do grafo.
-     * @return true se existe pelo menos uma ponte; caso contrário, false.
+     * @brief Calcula a menor distância entre todos os pares, com os vizinhos de cada vértice lidos direto das linhas
+     * da matriz e os pesos, das listas de arestas.
+     * @param distancias Matriz que recebe as distâncias.
+     * @param numThreads Número de threads (0 usa todos os núcleos).
      */
-    bool possuiPonte() override;
-
-    /**
-     * @brief Verifica se o grafo possui vértices de articulação.
-     * Um vértice de articulação é aquele cuja remoção aumenta o número de componentes conexos do grafo.
-     * @return true se existe pelo menos um vértice de articulação; caso contrário, false.
-     */
-    bool possuiArticulacao() override;
+    void todasDistancias(MatrizDistancias &distancias, int numThreads = 0) override;
 
     /**
      * @brief Remove uma aresta do grafo.
@@ -132,23 +164,9 @@ public:
      */
     void removeAresta(int idNoOrigem, int idNoDestino, bool direcionado) override;
 
-    /**
-     * @brief Carrega o grafo a partir de um arquivo.
-     * O arquivo deve conter os dados do grafo, como número de nós, tipo de grafo e arestas.
-     * @param arquivo Caminho para o arquivo de entrada.
-     */
-    void carregaGrafo(const std::string &arquivo) override;
-
-    /**
-     * @brief Cria um novo grafo a partir de um arquivo de configuração.
-     * O arquivo deve conter as informações do grafo, como tipo de estrutura, número de nós e arestas.
-     * @param arquivoConfig Caminho para o arquivo de configuração.
-     */
-    void novoGrafo(const std::string &arquivoConfig) override;
-
     /**
      * @brief Adiciona um nó ao grafo representado por matriz de adjacência.
-     * @param idNo ID do nó a ser adicionado.
+     * @param idNo Índice denso de um nó existente (a lista de adjacência liga o novo nó a ele).
      */
     void adicionaNo(int idNo) override;
 
@@ -0,0 +1,60 @@
+#ifndef HEAPRADIX_H
+#define HEAPRADIX_H
+
+#include <utility>
+#include <vector>
+
+/**
+ * @class HeapRadix
+ * @brief Fila de prioridade monótona para chaves inteiras não negativas (radix heap).
+ *
+ * Cada elemento fica no balde dado pelo bit mais significativo em que sua chave difere da última chave
+ * removida. Como as chaves removidas nunca diminuem (caso do Dijkstra com pesos não negativos), cada
+ * elemento só desce de balde, e as operações custam O(log C) amortizado, com C a maior chave, sem
+ * comparações entre elementos.
+ */
+class HeapRadix
+{
+public:
+    /**
+     * @brief Construtor; cria uma fila vazia.
+     */
+    HeapRadix();
+
+    /**
+     * @brief Insere um elemento.
+     * @param chave Prioridade; não pode ser menor que a última chave removida.
+     * @param valor Valor associado.
+     */
+    void insere(unsigned long long chave, int valor);
+
+    /**
+     * @brief Remove o elemento de menor chave.
+     * @param chave Recebe a chave removida.
+     * @param valor Recebe o valor associado.
+     */
+    void removeMinimo(unsigned long long &chave, int &valor);
+
+    /**
+     * @brief Verifica se a fila está vazia.
+     * @return true se não houver elementos.
+     */
+    bool vazio() const { return tamanho == 0; }
+
+    /**
+     * @brief Esvazia a fila e reinicia a última chave removida.
+     */
+    void limpa();
+
+private:
+    static const int NUM_BALDES = 65; ///< Balde 0 (chave igual à última) e um por bit de diferença.
+
+    std::vector<std::pair<unsigned long long, int>> baldes[NUM_BALDES]; ///< Elementos de cada balde.
+    unsigned long long ultima; ///< Última chave removida.
+    int tamanho;               ///< Número de elementos.
+
+    /// Balde em que uma chave deve ficar em relação à última chave removida.
+    int balde(unsigned long long chave) const;
+};
+
+#endif // HEAPRADIX_H
@@ -0,0 +1,30 @@
+#ifndef HEURISTICA_H
+#define HEURISTICA_H
+
+/**
+ * @class Heuristica
+ * @brief Interface das estimativas usadas pela busca A* (Grafo::menorDistanciaAEstrela).
+ *
+ * A estimativa é um limite inferior do custo restante de um vértice até o destino, contando, a cada passo,
+ * o peso da aresta e o do vértice de chegada (o peso do próprio vértice já foi contado). Para que a busca
+ * pare no primeiro caminho encontrado ela deve ser consistente: estimativa(u) <= custo(u, v) + estimativa(v)
+ * para toda aresta (u, v), e 0 no destino.
+ */
+class Heuristica
+{
+public:
+    /**
+     * @brief Destrutor virtual.
+     */
+    virtual ~Heuristica() {}
+
+    /**
+     * @brief Estima o custo restante de um vértice até o destino.
+     * @param v Índice denso do vértice.
+     * @param destino Índice denso do destino da busca.
+     * @return Limite inferior do custo (infinito se o destino for inalcançável a partir de v).
+     */
+    virtual double estimativa(int v, int destino) const = 0;
+};
+
+#endif // HEURISTICA_H
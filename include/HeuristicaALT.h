@@ -0,0 +1,55 @@
+#ifndef HEURISTICAALT_H
+#define HEURISTICAALT_H
+
+#include "Heuristica.h"
+#include <vector>
+
+class Grafo;
+
+/**
+ * @class HeuristicaALT
+ * @brief Heurística ALT (A*, marcos e desigualdade triangular) a partir de uma tabela de marcos pré-calculada.
+ *
+ * Para cada marco L são guardadas as distâncias de L a todos os vértices e de todos até L; pela desigualdade
+ * triangular, d(v, t) >= d(L, t) - d(L, v) e d(v, t) >= d(v, L) - d(t, L), e a estimativa é o maior desses
+ * limites entre os marcos. Os marcos são escolhidos um a um como o vértice mais distante dos já escolhidos.
+ * A tabela vale para a versão do grafo em que foi preparada e deve ser refeita após alterações.
+ */
+class HeuristicaALT : public Heuristica
+{
+public:
+    /**
+     * @brief Construtor; cria uma heurística sem marcos (estimativa sempre 0).
+     */
+    HeuristicaALT();
+
+    /**
+     * @brief Escolhe os marcos e calcula as distâncias de e até cada um.
+     * @param grafo Grafo sobre o qual as buscas serão feitas (pesos não negativos).
+     * @param numMarcos Número de marcos (limitado ao número de vértices).
+     * @return false se o grafo tiver pesos negativos.
+     */
+    bool prepara(Grafo &grafo, int numMarcos = 8);
+
+    /**
+     * @brief Estima o custo restante de v até o destino pelos marcos.
+     * @param v Índice denso do vértice.
+     * @param destino Índice denso do destino.
+     * @return Maior limite inferior entre os marcos.
+     */
+    double estimativa(int v, int destino) const override;
+
+    /**
+     * @brief Obtém os marcos escolhidos.
+     * @return Índices densos dos marcos.
+     */
+    const std::vector<int> &getMarcos() const { return marcos; }
+
+private:
+    int ordem;                  ///< Número de índices do grafo na preparação.
+    std::vector<int> marcos;    ///< Vértices escolhidos como marcos.
+    std::vector<double> doMarco;  ///< doMarco[k * ordem + v]: custo do marco k até v, sem o peso do marco.
+    std::vector<double> ateMarco; ///< ateMarco[k * ordem + v]: custo de v até o marco k, sem o peso de v.
+};
+
+#endif // HEURISTICAALT_H
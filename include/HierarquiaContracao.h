@@ -0,0 +1,179 @@
+#ifndef HIERARQUIACONTRACAO_H
+#define HIERARQUIACONTRACAO_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class Grafo;
+
+/**
+ * @class HierarquiaContracao
+ * @brief Índice de hierarquia de contração para consultas repetidas de menor distância em um grafo estático.
+ *
+ * Na construção os vértices são contraídos um a um, na ordem dada por uma prioridade (diferença de arestas mais
+ * vizinhos já contraídos, atualizada preguiçosamente); ao contrair v, cada caminho u -> v -> w sem outro caminho tão
+ * curto (busca de testemunha limitada) vira um atalho u -> w. Cada vértice guarda apenas os arcos para vértices
+ * contraídos depois dele, e a consulta é uma busca bidirecional que só sobe na hierarquia. Em grafos sem estrutura
+ * hierárquica (aleatórios, por exemplo) os atalhos crescem rápido; a contração então para e os vértices restantes
+ * formam um núcleo, percorrido pelas duas buscas com todos os seus arcos.
+ *
+ * Os vértices são renumerados pela ordem de contração (os mais altos primeiro), para que o topo da hierarquia,
+ * visitado por quase todas as consultas, fique contíguo na memória. Os atalhos guardam o vértice intermediário,
+ * e o caminho original pode ser reconstruído.
+ *
+ * O custo é o mesmo de Grafo::menorDistancia: o arco u -> v custa o peso da aresta mais o peso de v, e a distância
+ * inclui o peso da origem. O índice vale para a versão do grafo em que foi construído.
+ */
+class HierarquiaContracao
+{
+public:
+    /**
+     * @struct Arco
+     * @brief Arco do índice: vizinho, vértice intermediário (-1 se for uma aresta original) e custo.
+     */
+    struct Arco
+    {
+        int vizinho;
+        int meio;
+        double custo;
+    };
+
+    /**
+     * @brief Construtor; cria um índice vazio.
+     */
+    HierarquiaContracao();
+
+    /**
+     * @brief Constrói o índice a partir do grafo.
+     * @param grafo Grafo com custos de arco não negativos.
+     * @return false se algum arco tiver custo negativo.
+     */
+    bool constroi(Grafo &grafo);
+
+    /**
+     * @brief Abre o índice do grafo no diretório de cache (`<impressao>.ch`) ou, se não houver, o constrói e grava.
+     * Sem impressão digital válida (grafo alterado após a carga) ou com o cache desativado, apenas constrói.
+     * @param grafo Grafo com custos de arco não negativos.
+     * @return false se o índice não puder ser obtido.
+     */
+    bool prepara(Grafo &grafo);
+
+    /**
+     * @brief Calcula a menor distância entre dois vértices pela busca bidirecional ascendente.
+     * @param origem Índice denso do vértice de origem.
+     * @param destino Índice denso do vértice de destino.
+     * @param caminho Se não for nullptr, recebe os vértices do caminho, com os atalhos desfeitos.
+     * @return A distância, ou infinito se não houver caminho.
+     */
+    double distancia(int origem, int destino, std::vector<int> *caminho = nullptr);
+
+    /**
+     * @brief Grava o índice em um arquivo binário.
+     * @param arquivo Caminho do arquivo.
+     * @return true se o arquivo foi gravado.
+     */
+    bool salva(const std::string &arquivo) const;
+
+    /**
+     * @brief Lê um índice gravado por salva.
+     * @param arquivo Caminho do arquivo.
+     * @return true se o arquivo era um índice válido.
+     */
+    bool carrega(const std::string &arquivo);
+
+    /**
+     * @brief Obtém a impressão digital do grafo a partir do qual o índice foi construído.
+     * @return A impressão digital (0 se o grafo não tinha uma válida).
+     */
+    unsigned long long getImpressao() const { return impressao; }
+
+    /**
+     * @brief Obtém o tempo gasto na última construção.
+     * @return Tempo em segundos (0 se o índice foi lido de um arquivo).
+     */
+    double getTempoConstrucao() const { return tempoConstrucao; }
+
+    /**
+     * @brief Obtém o número de atalhos do índice.
+     * @return Número de arcos que não existem no grafo original.
+     */
+    int getNumAtalhos() const { return numAtalhos; }
+
+    /**
+     * @brief Obtém o número de vértices que ficaram sem contrair, no núcleo.
+     * @return Tamanho do núcleo (0 se todos foram contraídos).
+     */
+    int getTamanhoNucleo() const { return tamanhoNucleo; }
+
+    /**
+     * @brief Obtém o tamanho do índice, igual ao dos dados gravados por salva após o cabeçalho.
+     * @return Tamanho em bytes.
+     */
+    size_t getTamanho() const;
+
+    /**
+     * @brief Obtém o número de vértices fechados pela última consulta, somando as duas direções.
+     * @return Número de vértices fechados.
+     */
+    int getVerticesVisitados() const { return verticesVisitados; }
+
+private:
+    /**
+     * @struct Rotulo
+     * @brief Estado de um vértice em uma das direções da consulta.
+     */
+    struct Rotulo
+    {
+        double distancia;   ///< Distância provisória.
+        int anterior;       ///< Posição do vértice anterior na árvore da busca.
+        int arco;           ///< Posição, em sobe ou desce, do arco que levou ao vértice.
+        unsigned int marca; ///< Número da consulta em que o rótulo foi escrito.
+    };
+
+    int ordem;                      ///< Número de índices do grafo na construção.
+    unsigned long long impressao;   ///< Impressão digital do grafo indexado.
+    double tempoConstrucao;         ///< Duração da última construção, em segundos.
+    int numAtalhos;                 ///< Número de atalhos criados.
+    int tamanhoNucleo;              ///< Vértices que ficaram sem contrair.
+    std::vector<float> pesosNos;    ///< Peso de cada vértice, pelo índice denso (somado ao custo a partir da origem).
+    std::vector<int> posicao;       ///< Posição de cada índice denso no índice (-1 para os removidos).
+    std::vector<int> original;      ///< Índice denso de cada posição.
+    std::vector<int> inicioSobe;    ///< Início dos arcos v -> w (w acima de v) de cada posição em sobe.
+    std::vector<Arco> sobe;         ///< Arcos para vértices mais altos, usados pela busca a partir da origem.
+    std::vector<int> inicioDesce;   ///< Início dos arcos u -> v (u acima de v) de cada posição em desce.
+    std::vector<Arco> desce;        ///< Arcos vindos de vértices mais altos, percorridos ao contrário a partir do destino.
+
+    std::vector<Rotulo> rotulos[2]; ///< Rótulos das buscas a partir da origem (0) e do destino (1), reaproveitados.
+    unsigned int consulta;          ///< Número da consulta atual (marca dos rótulos válidos).
+    int verticesVisitados;          ///< Vértices fechados pela última consulta.
+
+    /**
+     * @brief Busca o intermediário do arco a -> b do índice.
+     * @param a Posição da origem do arco.
+     * @param b Posição do destino do arco.
+     * @return Posição do intermediário (-1 se for uma aresta original).
+     */
+    int meioArco(int a, int b) const;
+
+    /**
+     * @brief Acrescenta ao caminho os vértices depois de a até b, desfazendo os atalhos.
+     * @param a Posição da origem do arco.
+     * @param b Posição do destino do arco.
+     * @param meio Intermediário do arco (-1 se for uma aresta original).
+     * @param caminho Caminho, em índices densos.
+     */
+    void desempacota(int a, int b, int meio, std::vector<int> &caminho) const;
+
+    /**
+     * @brief Prepara os rótulos das consultas para o número de vértices do índice.
+     */
+    void reiniciaConsultas();
+
+    /**
+     * @brief Esvazia o índice.
+     */
+    void limpa();
+};
+
+#endif // HIERARQUIACONTRACAO_H
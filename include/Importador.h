@@ -0,0 +1,106 @@
+#ifndef IMPORTADOR_H
+#define IMPORTADOR_H
+
+#include "MapaIds.h"
+#include <string>
+#include <vector>
+
+/**
+ * @enum FormatoGrafo
+ * @brief Formatos de arquivo de grafo reconhecidos pelo Importador.
+ */
+enum class FormatoGrafo
+{
+    Nativo,       ///< Formato dos arquivos `grafo*.txt` (cabeçalho `nós direcionado ponderado_vertices ponderado_arestas`).
+    ListaArestas, ///< Lista de arestas simples, uma aresta `origem destino [peso]` por linha.
+    Dimacs,       ///< Formato DIMACS (`.clq`, `.col`), com linhas `p edge n m` e `e u v`.
+    Metis,        ///< Formato METIS (`.graph`), com uma linha de adjacência por vértice.
+    MatrixMarket, ///< Formato MatrixMarket coordenado (`.mtx`).
+    Configuracao, ///< Arquivo de configuração: estrutura (`matriz` ou `lista`) seguida do formato nativo.
+    Desconhecido  ///< Formato não identificado.
+};
+
+/**
+ * @struct ArestaLida
+ * @brief Aresta lida de um arquivo, com IDs já ajustados para índices baseados em 0.
+ */
+struct ArestaLida
+{
+    int origem;  ///< Índice do vértice de origem.
+    int destino; ///< Índice do vértice de destino.
+    float peso;  ///< Peso da aresta (1 quando o arquivo não informa pesos).
+};
+
+/**
+ * @struct DadosGrafo
+ * @brief Representação intermediária de um grafo lido de arquivo.
+ *
+ * Todos os importadores produzem esta estrutura, que é então entregue ao backend (matriz ou lista)
+ * pelo mesmo caminho de construção, independentemente do formato de origem.
+ */
+struct DadosGrafo
+{
+    int ordem = 0;                     ///< Número de vértices.
+    bool direcionado = false;          ///< Indica se o grafo é direcionado.
+    bool ponderadoVertices = false;    ///< Indica se os vértices possuem pesos.
+    bool ponderadoArestas = false;     ///< Indica se as arestas possuem pesos.
+    std::vector<float> pesosVertices;  ///< Pesos dos vértices (vazio se não ponderado).
+    std::vector<ArestaLida> arestas;   ///< Arestas lidas, com índices baseados em 0.
+    std::string estrutura;             ///< Estrutura pedida pelo arquivo de configuração (vazio nos demais formatos).
+    MapaIds ids;                       ///< IDs externos dos vértices (se não configurado, IDs 1..ordem).
+};
+
+/**
+ * @class Importador
+ * @brief Leitura de grafos em diversos formatos de arquivo.
+ *
+ * O arquivo é lido de uma só vez para a memória e interpretado sem o uso de streams formatados.
+ * O formato é detectado pela extensão do arquivo e, quando ela não é conclusiva, pelo cabeçalho.
+ */
+class Importador
+{
+public:
+    /**
+     * @brief Detecta o formato de um arquivo de grafo.
+     * @param arquivo Caminho do arquivo (usado para inspecionar a extensão).
+     * @param conteudo Conteúdo do arquivo (usado para inspecionar o cabeçalho).
+     * @return O formato detectado.
+     */
+    static FormatoGrafo detectaFormato(const std::string &arquivo, const std::string &conteudo);
+
+    /**
+     * @brief Carrega um grafo de um arquivo, detectando automaticamente o formato.
+     * @param arquivo Caminho para o arquivo de entrada.
+     * @param dados Estrutura que recebe o grafo lido.
+     * @return true se a leitura foi bem-sucedida, false caso contrário.
+     */
+    static bool carrega(const std::string &arquivo, DadosGrafo &dados);
+
+    /**
+     * @brief Carrega um grafo de um arquivo em um formato específico.
+     * @param arquivo Caminho para o arquivo de entrada.
+     * @param formato Formato do arquivo.
+     * @param dados Estrutura que recebe o grafo lido.
+     * @return true se a leitura foi bem-sucedida, false caso contrário.
+     */
+    static bool carrega(const std::string &arquivo, FormatoGrafo formato, DadosGrafo &dados);
+
+    /**
+     * @brief Obtém o nome legível de um formato.
+     * @param formato Formato desejado.
+     * @return Nome do formato.
+     */
+    static const char *nomeFormato(FormatoGrafo formato);
+
+private:
+    static bool leArquivo(const std::string &arquivo, std::string &conteudo);
+    static bool leNativo(const std::string &conteudo, DadosGrafo &dados);
+    static bool leListaArestas(const std::string &conteudo, DadosGrafo &dados);
+    static bool leDimacs(const std::string &conteudo, DadosGrafo &dados);
+    static bool leMetis(const std::string &conteudo, DadosGrafo &dados);
+    static bool leMatrixMarket(const std::string &conteudo, DadosGrafo &dados);
+    static bool leConfiguracao(const std::string &conteudo, DadosGrafo &dados);
+    static bool interpreta(const std::string &conteudo, FormatoGrafo formato, DadosGrafo &dados);
+};
+
+#endif // IMPORTADOR_H
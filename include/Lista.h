@@ -15,6 +15,13 @@ class Lista
 private:
     No *cabeca;     ///< Ponteiro para o primeiro nó da lista.
     int tamanho;    ///< Número de elementos na lista.
+    Arena *arena;   ///< Arena de onde saem os nós da lista (nullptr: alocação individual).
+
+    /// Cria um nó da lista, na arena quando houver.
+    No *criaNo(int idNo, float pesoNo);
+
+    /// Libera um nó da lista, devolvendo-o à arena quando houver.
+    void liberaNo(No *no);
 
 public:
     /**
@@ -43,12 +50,7 @@ public:
         if (this != &other)
         {
             // Clear current list
-            while (cabeca != nullptr)
-            {
-                No *temp = cabeca;
-                cabeca = cabeca->getProxNo();
-                delete temp;
-            }
+            limpa();
 
             // Copy from other list
             No *current = other.cabeca;
@@ -70,6 +72,22 @@ public:
      */
     void adicionar(int idNo, float pesoNo = 0.0);
 
+    /**
+     * @brief Substitui o conteúdo da lista por uma sequência de nós, em lote.
+     *
+     * Os nós são encadeados na mesma ordem do array, em uma única passada,
+     * sem percorrer a lista a cada inserção.
+     * @param ids IDs dos nós, na ordem desejada.
+     * @param pesos Pesos associados a cada nó (pode ser nullptr).
+     * @param quantidade Número de nós.
+     */
+    void preenche(const int *ids, const float *pesos, int quantidade);
+
+    /**
+     * @brief Remove todos os nós da lista.
+     */
+    void limpa();
+
     /**
      * @brief Remove um nó da lista pelo seu ID.
      * 
@@ -96,6 +114,31 @@ public:
      */
     No *getElemento(int posicao) const;
 
+    /**
+     * @brief Obtém o primeiro nó da lista, para percorrê-la em sequência com No::getProxNo.
+     * @return Ponteiro para o primeiro nó, ou nullptr se a lista estiver vazia.
+     */
+    No *getPrimeiro() const;
+
+    /**
+     * @brief Troca o conteúdo desta lista com o de outra, sem copiar os nós.
+     * @param outra Lista cujo conteúdo é trocado com o desta.
+     */
+    void troca(Lista &outra);
+
+    /**
+     * @brief Define a arena da qual os nós da lista passam a ser alocados.
+     * Deve ser chamada com a lista vazia.
+     * @param arena Arena a usar (nullptr para alocação individual).
+     */
+    void usaArena(Arena *arena);
+
+    /**
+     * @brief Esquece os nós da lista sem liberá-los um a um.
+     * Usada quando a arena que contém os nós vai ser liberada de uma vez.
+     */
+    void solta();
+
     /**
      * @brief Obtém o tamanho da lista.
      * 
@@ -0,0 +1,105 @@
+#ifndef MAPAIDS_H
+#define MAPAIDS_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class MapaIds
+ * @brief Correspondência entre os IDs externos dos vértices (64 bits, possivelmente esparsos) e os índices densos internos.
+ *
+ * Todos os algoritmos trabalham com índices densos 0..n-1; os IDs externos só aparecem na entrada e na saída.
+ * Quando os IDs do arquivo já são densos (base, base + 1, ...), o mapa fica no modo identidade e não ocupa memória.
+ * Caso contrário, usa uma tabela hash de endereçamento aberto (sondagem linear) de ID externo para índice
+ * e um vetor reverso de índice para ID externo.
+ */
+class MapaIds
+{
+public:
+    /**
+     * @brief Construtor padrão; cria um mapa identidade vazio com IDs baseados em 1.
+     */
+    MapaIds();
+
+    /**
+     * @brief Configura o modo identidade: o índice i corresponde ao ID externo i + base.
+     * @param quantidade Número de vértices.
+     * @param base ID externo do índice 0.
+     */
+    void configuraIdentidade(int quantidade, long long base);
+
+    /**
+     * @brief Reserva espaço para uma quantidade de IDs explícitos, evitando redimensionamentos da tabela.
+     * @param quantidade Número esperado de IDs.
+     */
+    void reserva(int quantidade);
+
+    /**
+     * @brief Obtém o índice de um ID externo, inserindo-o no fim caso ainda não exista.
+     * No modo identidade, um ID que não seja o próximo da sequência converte o mapa para o modo explícito.
+     * @param externo ID externo do vértice.
+     * @return Índice denso do vértice.
+     */
+    int insere(long long externo);
+
+    /**
+     * @brief Obtém o índice denso de um ID externo.
+     * @param externo ID externo do vértice.
+     * @return Índice denso, ou -1 se o ID não existir.
+     */
+    int indice(long long externo) const;
+
+    /**
+     * @brief Obtém o ID externo de um índice denso.
+     * @param indice Índice denso do vértice (deve ser válido).
+     * @return ID externo do vértice.
+     */
+    long long externo(int indice) const;
+
+    /**
+     * @brief Obtém um ID externo ainda não usado, maior que todos os existentes.
+     * @return ID para um novo vértice.
+     */
+    long long proximoLivre() const;
+
+    /**
+     * @brief Renumera os índices em uma única passada, descartando os removidos.
+     * @param novoIndice Novo índice de cada índice atual (-1 para os removidos), em ordem crescente.
+     * @param novaQuantidade Número de índices que permanecem.
+     */
+    void compacta(const std::vector<int> &novoIndice, int novaQuantidade);
+
+    /**
+     * @brief Obtém o número de vértices mapeados.
+     * @return Quantidade de índices.
+     */
+    int tamanho() const;
+
+    /**
+     * @brief Indica se o mapa está no modo identidade.
+     * @return true se o índice i corresponde ao ID i + base.
+     */
+    bool ehIdentidade() const;
+
+private:
+    int quantidade;                  ///< Número de vértices mapeados.
+    long long base;                  ///< ID externo do índice 0 no modo identidade.
+    long long maiorId;               ///< Maior ID externo já mapeado.
+    std::vector<long long> externos; ///< ID externo de cada índice (vazio no modo identidade).
+    std::vector<long long> chaves;   ///< Chaves da tabela hash.
+    std::vector<int> valores;        ///< Índice de cada posição da tabela (-1 indica posição livre).
+
+    /// Converte o modo identidade em explícito, materializando os IDs.
+    void materializa();
+
+    /// Reconstrói a tabela hash com pelo menos a capacidade pedida (potência de 2).
+    void redimensiona(int capacidade);
+
+    /// Insere um par já conhecido como ausente na tabela hash.
+    void insereNaTabela(long long externo, int indice);
+
+    /// Posição inicial de um ID na tabela (mistura de bits antes da máscara).
+    std::size_t posicao(long long externo) const;
+};
+
+#endif // MAPAIDS_H
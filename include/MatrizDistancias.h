@@ -0,0 +1,113 @@
+#ifndef MATRIZDISTANCIAS_H
+#define MATRIZDISTANCIAS_H
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/**
+ * @class MatrizDistancias
+ * @brief Matriz compacta de distâncias entre todos os pares de vértices.
+ *
+ * As distâncias ficam em um único buffer de float, linha a linha, com o passo entre linhas arredondado para
+ * 16 floats (64 bytes). O arquivo gravado por salva tem um cabeçalho de 64 bytes seguido exatamente desse
+ * buffer, de modo que carrega pode mapeá-lo na memória (mmap, quando disponível) e usá-lo sem conversão.
+ * Pares sem caminho têm distância INFINITO.
+ */
+class MatrizDistancias
+{
+public:
+    static const float INFINITO; ///< Distância entre vértices sem caminho.
+
+    /**
+     * @brief Construtor padrão; cria uma matriz vazia.
+     */
+    MatrizDistancias();
+
+    /**
+     * @brief Destrutor; libera o buffer ou desfaz o mapeamento do arquivo.
+     */
+    ~MatrizDistancias();
+
+    /**
+     * @brief Redimensiona a matriz para n vértices, com INFINITO em todas as posições.
+     * @param n Número de vértices.
+     */
+    void redimensiona(int n);
+
+    /**
+     * @brief Obtém o número de vértices.
+     * @return Ordem da matriz.
+     */
+    int getOrdem() const { return ordem; }
+
+    /**
+     * @brief Obtém a linha de distâncias a partir de um vértice.
+     * @param i Índice do vértice de origem.
+     * @return Ponteiro para as n distâncias da linha.
+     */
+    float *linha(int i) { return dados + static_cast<std::size_t>(i) * passo; }
+
+    /**
+     * @brief Obtém a linha de distâncias a partir de um vértice (somente leitura).
+     * @param i Índice do vértice de origem.
+     * @return Ponteiro para as n distâncias da linha.
+     */
+    const float *linha(int i) const { return dados + static_cast<std::size_t>(i) * passo; }
+
+    /**
+     * @brief Obtém a distância entre dois vértices.
+     * @param origem Índice do vértice de origem.
+     * @param destino Índice do vértice de destino.
+     * @return Distância, ou INFINITO se não houver caminho.
+     */
+    float distancia(int origem, int destino) const { return linha(origem)[destino]; }
+
+    /**
+     * @brief Fecha a matriz por Floyd–Warshall em blocos: ao final, cada posição contém o menor custo
+     * de caminho, supondo que a matriz começou com os custos das arestas.
+     *
+     * A matriz é dividida em blocos de TAMANHO_BLOCO × TAMANHO_BLOCO; em cada rodada o bloco da diagonal é
+     * fechado, depois os blocos da mesma linha e coluna e, por fim, os demais, em paralelo entre threads.
+     * A atualização min-mais das linhas usa VarreduraLinha::minMais.
+     * @param numThreads Número de threads (0 usa o número de núcleos disponíveis).
+     */
+    void floydWarshall(int numThreads = 0);
+
+    /**
+     * @brief Grava a matriz em um arquivo binário que pode ser mapeado de volta por carrega.
+     * @param arquivo Caminho do arquivo.
+     * @return true se o arquivo foi gravado.
+     */
+    bool salva(const std::string &arquivo) const;
+
+    /**
+     * @brief Carrega uma matriz gravada por salva, mapeando o arquivo na memória quando possível.
+     * O mapeamento é privado: alterações na matriz não são escritas de volta no arquivo.
+     * @param arquivo Caminho do arquivo.
+     * @return true se o arquivo foi lido e é válido.
+     */
+    bool carrega(const std::string &arquivo);
+
+private:
+    static const int TAMANHO_BLOCO = 64; ///< Lado dos blocos do Floyd–Warshall.
+    static const int ALINHAMENTO = 16;   ///< Passo das linhas é múltiplo deste número de floats.
+
+    int ordem;                 ///< Número de vértices.
+    int passo;                 ///< Distância, em floats, entre linhas consecutivas.
+    float *dados;              ///< Início da primeira linha (no buffer próprio ou no arquivo mapeado).
+    std::vector<float> buffer; ///< Armazenamento próprio (vazio quando o arquivo está mapeado).
+    void *mapa;                ///< Início do arquivo mapeado (nullptr se não houver).
+    std::size_t tamanhoMapa;   ///< Tamanho do mapeamento, em bytes.
+
+    /// Desfaz o mapeamento do arquivo, se houver.
+    void desmapeia();
+
+    /// Relaxa o bloco (ib, jb) por todos os vértices intermediários do bloco kb.
+    void atualizaBloco(int ib, int jb, int kb);
+
+    MatrizDistancias(const MatrizDistancias &) = delete;
+    MatrizDistancias &operator=(const MatrizDistancias &) = delete;
+};
+
+#endif // MATRIZDISTANCIAS_H
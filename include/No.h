@@ -2,6 +2,7 @@
 #define NO_H
 
 #include "Aresta.h"
+#include "Arena.h"
 
 /**
  * @class No
@@ -20,6 +21,10 @@ private:
     Aresta *primeiraAresta; ///< Ponteiro para a primeira aresta associada ao nó.
     Aresta *ultimaAresta;   ///< Ponteiro para a última aresta associada ao nó.
     No *proxNo;             ///< Ponteiro para o próximo nó na lista de nós.
+    Arena *arenaArestas;    ///< Arena de onde saem as arestas do nó (nullptr: alocação individual).
+
+    /// Libera uma aresta do nó, devolvendo-a à arena quando houver.
+    void liberaAresta(Aresta *aresta);
 
 public:
     /**
@@ -29,8 +34,9 @@ public:
      * além de inicializar os ponteiros para as arestas e o próximo nó.
      * @param idNo O ID do nó.
      * @param pesoNo O peso do nó (padrão 0.0).
+     * @param arenaArestas Arena da qual as arestas do nó são alocadas (nullptr para alocação individual).
      */
-    No(int idNo, float pesoNo = 0.0);
+    No(int idNo, float pesoNo = 0.0, Arena *arenaArestas = nullptr);
 
     /**
      * @brief Destrutor da classe No.
@@ -92,6 +98,14 @@ public:
      */
     void adicionaAresta(int destino, float peso = 1.0, bool direcionado = false);
 
+    /**
+     * @brief Adiciona uma aresta ao nó, apontando diretamente para o nó de destino.
+     * @param destino Ponteiro para o nó de destino da aresta.
+     * @param peso O peso da aresta.
+     * @param direcionado Indica se a aresta é direcionada (true) ou não (false).
+     */
+    void adicionaAresta(No *destino, float peso, bool direcionado);
+
     /**
      * @brief Remove uma aresta do nó.
      * 
@@ -0,0 +1,32 @@
+#ifndef PARALELO_H
+#define PARALELO_H
+
+#include <functional>
+
+/**
+ * @class Paralelo
+ * @brief Execução de tarefas independentes em várias threads.
+ *
+ * As tarefas são numeradas de 0 a numTarefas - 1 e distribuídas dinamicamente por um contador compartilhado,
+ * de modo que threads que terminam antes pegam as tarefas restantes. A thread chamadora também trabalha.
+ */
+class Paralelo
+{
+public:
+    /**
+     * @brief Resolve o número de threads pedido.
+     * @param pedido Número pedido (0 ou negativo: número de núcleos disponíveis).
+     * @return Número de threads, no mínimo 1.
+     */
+    static int resolveThreads(int pedido);
+
+    /**
+     * @brief Executa tarefa(0), ..., tarefa(numTarefas - 1), possivelmente em paralelo, e espera todas terminarem.
+     * @param numTarefas Número de tarefas.
+     * @param numThreads Número máximo de threads (com 1, tudo roda na thread chamadora).
+     * @param tarefa Função chamada com o número de cada tarefa.
+     */
+    static void executa(int numTarefas, int numThreads, const std::function<void(int)> &tarefa);
+};
+
+#endif // PARALELO_H
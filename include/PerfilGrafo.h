@@ -0,0 +1,49 @@
+#ifndef PERFILGRAFO_H
+#define PERFILGRAFO_H
+
+#include <string>
+
+/**
+ * @struct PerfilGrafo
+ * @brief Propriedades estruturais do grafo obtidas em uma única passada de busca em profundidade.
+ *
+ * Conectividade, bipartição, pontes e articulações são calculadas sobre o grafo subjacente não
+ * direcionado (para grafos direcionados, as componentes são as fracamente conexas); as componentes fortemente
+ * conexas seguem o sentido dos arcos.
+ * Os graus são os graus de saída, como em Grafo::getGrau.
+ */
+struct PerfilGrafo
+{
+    int ordem = 0;                 ///< Número de vértices.
+    int numArestas = 0;            ///< Número de arestas (cada aresta não direcionada conta uma vez).
+    int componentes = 0;           ///< Número de componentes conexas.
+    int componentesBipartidas = 0; ///< Número de componentes que admitem 2-coloração.
+    int componentesFortes = 0;     ///< Número de componentes fortemente conexas (igual a componentes se não direcionado).
+    int numPontes = 0;             ///< Número de arestas ponte.
+    int numArticulacoes = 0;       ///< Número de vértices de articulação.
+    int grauMinimo = 0;            ///< Menor grau de saída.
+    int grauMaximo = 0;            ///< Maior grau de saída.
+    double grauMedio = 0.0;        ///< Grau de saída médio.
+    bool completo = false;         ///< Indica se todo vértice é adjacente a todos os demais.
+    bool arvore = false;           ///< Indica se o grafo subjacente é conexo e acíclico.
+
+    /**
+     * @brief Indica se todas as componentes são bipartidas.
+     */
+    bool bipartido() const { return componentesBipartidas == componentes; }
+
+    /**
+     * @brief Converte o perfil em uma linha de texto (usada pelo cache de análise).
+     * @return Campos separados por ';'.
+     */
+    std::string serializa() const;
+
+    /**
+     * @brief Reconstrói o perfil a partir do texto gerado por serializa().
+     * @param texto Linha com os campos separados por ';'.
+     * @return true se o texto estava no formato esperado, false caso contrário.
+     */
+    bool desserializa(const std::string &texto);
+};
+
+#endif // PERFILGRAFO_H
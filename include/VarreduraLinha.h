@@ -0,0 +1,68 @@
+#ifndef VARREDURALINHA_H
+#define VARREDURALINHA_H
+
+/**
+ * @class VarreduraLinha
+ * @brief Varreduras de linhas da matriz de adjacência com instruções vetoriais.
+ *
+ * Cada operação tem uma versão AVX2, uma SSE2 e uma escalar; a versão usada é escolhida uma única vez,
+ * na primeira chamada, conforme o processador (a variável de ambiente GRAFO_SEM_SIMD força a escalar).
+ * As linhas são vetores de int em que 0 indica ausência de aresta; os vetores de cobertura usam 0 para
+ * vértice livre e 1 para vértice coberto. minMais opera sobre linhas de distâncias (float).
+ */
+class VarreduraLinha
+{
+public:
+    /**
+     * @brief Conta as células não nulas de uma linha (grau do vértice).
+     * @param linha Início da linha.
+     * @param n Número de células.
+     * @return Quantidade de células diferentes de 0.
+     */
+    static int contaNaoNulos(const int *linha, int n);
+
+    /**
+     * @brief Conta os vizinhos ainda não cobertos (linha[j] != 0 e cobertos[j] == 0).
+     * @param linha Início da linha.
+     * @param cobertos Marca de cobertura de cada vértice.
+     * @param n Número de células.
+     * @return Grau residual do vértice.
+     */
+    static int contaLivres(const int *linha, const int *cobertos, int n);
+
+    /**
+     * @brief Procura a próxima célula não nula a partir de uma posição.
+     * @param linha Início da linha.
+     * @param inicio Primeira posição examinada.
+     * @param n Número de células.
+     * @return Posição encontrada, ou n se não houver.
+     */
+    static int proximoNaoNulo(const int *linha, int inicio, int n);
+
+    /**
+     * @brief Procura o próximo vizinho não coberto a partir de uma posição.
+     * @param linha Início da linha.
+     * @param cobertos Marca de cobertura de cada vértice.
+     * @param inicio Primeira posição examinada.
+     * @param n Número de células.
+     * @return Posição encontrada, ou n se não houver.
+     */
+    static int proximoLivre(const int *linha, const int *cobertos, int inicio, int n);
+
+    /**
+     * @brief Relaxa uma linha de distâncias por um vértice intermediário: destino[j] = min(destino[j], valor + origem[j]).
+     * @param destino Linha atualizada.
+     * @param origem Linha de distâncias a partir do intermediário.
+     * @param valor Distância até o intermediário.
+     * @param n Número de células.
+     */
+    static void minMais(float *destino, const float *origem, float valor, int n);
+
+    /**
+     * @brief Obtém o nome da implementação escolhida ("avx2", "sse2" ou "escalar").
+     * @return Nome da implementação.
+     */
+    static const char *implementacao();
+};
+
+#endif // VARREDURALINHA_H
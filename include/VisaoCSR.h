@@ -0,0 +1,67 @@
+#ifndef VISAOCSR_H
+#define VISAOCSR_H
+
+#include "Importador.h"
+#include <vector>
+
+/**
+ * @class VisaoCSR
+ * @brief Adjacência compacta no formato CSR (Compressed Sparse Row).
+ *
+ * Os vizinhos do vértice v ocupam as posições [inicio[v], inicio[v + 1]) dos vetores
+ * vizinhos e pesos, em ordem crescente de ID. É usada na construção em lote dos backends
+ * e como visão somente leitura do grafo para os algoritmos que percorrem toda a adjacência.
+ */
+class VisaoCSR
+{
+public:
+    int ordem;                  ///< Número de vértices.
+    std::vector<int> inicio;    ///< Deslocamento do primeiro vizinho de cada vértice (tamanho ordem + 1).
+    std::vector<int> vizinhos;  ///< IDs dos vizinhos, agrupados por vértice de origem.
+    std::vector<float> pesos;   ///< Peso de cada entrada de vizinhos.
+
+    /**
+     * @brief Construtor padrão; cria uma visão vazia.
+     */
+    VisaoCSR() : ordem(0) {}
+
+    /**
+     * @brief Constrói a visão a partir de uma lista de arestas, com ordenação por contagem.
+     *
+     * Arestas repetidas são mantidas uma única vez (prevalece o último peso lido).
+     * Se o grafo não for direcionado, cada aresta é registrada nos dois sentidos.
+     * @param ordem Número de vértices.
+     * @param arestas Arestas com índices baseados em 0.
+     * @param direcionado Indica se o grafo é direcionado.
+     */
+    void constroi(int ordem, const std::vector<ArestaLida> &arestas, bool direcionado);
+
+    /**
+     * @brief Obtém a versão simétrica desta visão (grafo subjacente não direcionado).
+     * Cada entrada v -> w passa a existir também como w -> v, sem repetições.
+     * @return A visão simétrica.
+     */
+    VisaoCSR simetrica() const;
+
+    /**
+     * @brief Obtém a visão transposta: cada entrada v -> w passa a ser w -> v, com o mesmo peso.
+     * Os vizinhos de cada vértice continuam em ordem crescente de ID, sem nova ordenação.
+     * @return A visão transposta (vizinhos de entrada de cada vértice).
+     */
+    VisaoCSR transposta() const;
+
+    /**
+     * @brief Obtém o grau de saída de um vértice.
+     * @param v Índice do vértice.
+     * @return Número de vizinhos de v.
+     */
+    int grau(int v) const { return inicio[v + 1] - inicio[v]; }
+
+    /**
+     * @brief Obtém o número de entradas armazenadas (arestas, contando os dois sentidos se não direcionado).
+     * @return Número de entradas.
+     */
+    int numEntradas() const { return inicio.empty() ? 0 : inicio[ordem]; }
+};
+
+#endif // VISAOCSR_H
@@ -1,13 +1,101 @@
 #include "include/Grafo.h"
 #include "include/GrafoMatriz.h"
 #include "include/GrafoLista.h"
+#include "include/Importador.h"
+#include "include/CacheAnalise.h"
+#include "include/HierarquiaContracao.h"
+#include "include/BuscaLarguraMultipla.h"
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <fstream>
+#include <functional>
+#include <sstream>
 #include <string>
 #include <stdexcept>
+#include <vector>
+#include <cstdlib>
 
 using namespace std;
 
+/**
+ * @brief Obtém uma propriedade do cache de análise ou a calcula e armazena.
+ * @param cache Cache de análise do grafo.
+ * @param chave Nome da propriedade no cache.
+ * @param calculo Função que calcula a propriedade quando ela não está no cache.
+ * @return Valor da propriedade.
+ */
+string obtemPropriedade(CacheAnalise &cache, const string &chave, const function<string()> &calculo)
+{
+    string valor;
+    if (!cache.obtem(chave, valor))
+    {
+        valor = calculo();
+        cache.grava(chave, valor);
+    }
+    return valor;
+}
+
+/**
+ * @brief Converte um valor booleano para texto.
+ */
+const char *simNao(bool valor)
+{
+    return valor ? "Sim" : "Não";
+}
+
+/**
+ * @brief Obtém uma cobertura do cache de análise ou executa o algoritmo e armazena o resultado.
+ * @param cache Cache de análise do grafo.
+ * @param chave Nome da cobertura no cache (inclui algoritmo, parâmetros e semente).
+ * @param algoritmo Função que executa o algoritmo e devolve a cobertura (ou nullptr).
+ * @param cobertura Recebe os vértices da cobertura.
+ * @return true se uma cobertura foi encontrada, false caso contrário.
+ */
+bool obtemCobertura(CacheAnalise &cache, const string &chave, const function<int *(int *)> &algoritmo, vector<int> &cobertura)
+{
+    cobertura.clear();
+    string valor;
+    if (cache.obtem(chave, valor))
+    {
+        istringstream entrada(valor);
+        int vertice;
+        while (entrada >> vertice)
+        {
+            cobertura.push_back(vertice);
+        }
+        return true;
+    }
+
+    int tamanhoCobertura;
+    int *resultado = algoritmo(&tamanhoCobertura);
+    if (resultado == nullptr)
+    {
+        return false;
+    }
+    ostringstream saida;
+    for (int i = 0; i < tamanhoCobertura; i++)
+    {
+        cobertura.push_back(resultado[i]);
+        saida << (i > 0 ? " " : "") << resultado[i];
+    }
+    delete[] resultado;
+    cache.grava(chave, saida.str());
+    return true;
+}
+
+/**
+ * @brief Abre o cache de análise do grafo, ativo apenas se o grafo não foi alterado após a carga.
+ * Os resultados ficam separados por representação (matriz ou lista).
+ */
+CacheAnalise abreCache(Grafo *grafo)
+{
+    unsigned long long impressao;
+    bool semAlteracao = grafo->getImpressaoDigital(impressao);
+    const char *representacao = dynamic_cast<GrafoMatriz *>(grafo) != nullptr ? "matriz" : "lista";
+    return CacheAnalise(impressao, representacao, semAlteracao);
+}
+
 /**
  * @brief Imprime a descrição do grafo fornecido.
  * 
@@ -17,13 +105,17 @@ using namespace std;
  * - Se o grafo contém vértices ponderados.
  * - Se o grafo contém arestas ponderadas.
  * - Grau do vértice 0, ou seja, o número de arestas que incidem sobre o vértice 0.
- * - Número de componentes conexas no grafo.
+ * - Número de componentes conexas no grafo; em grafos direcionados, as fracamente conexas (ignorando o sentido dos
+ *   arcos) e as fortemente conexas.
  * - Se o grafo é completo (ou seja, se há uma aresta entre todos os pares de vértices distintos).
  * - Se o grafo é bipartido.
  * - Se o grafo é uma árvore (ou seja, se é conexo e acíclico).
  * - Se o grafo possui aresta ponte (aresta cuja remoção aumenta o número de componentes conexas).
  * - Se o grafo possui vértice de articulação (vértice cuja remoção aumenta o número de componentes conexas).
  * 
+ * As propriedades estruturais são obtidas juntas por Grafo::calculaPerfil (uma única busca em profundidade)
+ * e guardadas no cache de análise (indexado pela impressão digital do grafo e pela representação), de modo que só são
+ * calculadas na primeira vez em que o mesmo grafo é analisado.
  * Caso algum cálculo ou verificação não seja possível, um erro será capturado e uma mensagem de erro será exibida.
  * 
  * @param grafo Ponteiro para o grafo que será descrito.
@@ -32,6 +124,8 @@ using namespace std;
  */
 void imprimeDescricao(Grafo *grafo)
 {
+    CacheAnalise cache = abreCache(grafo);
+
     cout << "========== Descrição do Grafo ==========" << endl;
     cout << "Ordem: " << grafo->getOrdem() << endl;
     cout << "Direcionado: " << (grafo->ehDirecionado() ? "Sim" : "Não") << endl;
@@ -48,65 +142,40 @@ void imprimeDescricao(Grafo *grafo)
         cout << "Erro ao calcular grau do vértice 0." << endl;
     }
 
-    // Componentes conexas
-    try
-    {
-        cout << "Componentes conexas: " << grafo->nConexo() << endl;
-    }
-    catch (...)
-    {
-        cout << "Erro ao calcular componentes conexas." << endl;
-    }
-
-    // Verifica se o grafo é completo
+    // Todas as propriedades estruturais saem de uma única busca em profundidade
+    PerfilGrafo perfil;
     try
     {
-        cout << "Completo: " << (grafo->ehCompleto() ? "Sim" : "Não") << endl;
-    }
-    catch (...)
-    {
-        cout << "Erro ao verificar se o grafo é completo." << endl;
-    }
-
-    // Verifica se o grafo é bipartido
-    try
-    {
-        cout << "Bipartido: " << (grafo->ehBipartido() ? "Sim" : "Não") << endl;
-    }
-    catch (...)
-    {
-        cout << "Erro ao verificar se o grafo é bipartido." << endl;
-    }
-
-    // Verifica se o grafo é uma árvore
-    try
-    {
-        cout << "Árvore: " << (grafo->ehArvore() ? "Sim" : "Não") << endl;
-    }
-    catch (...)
-    {
-        cout << "Erro ao verificar se o grafo é uma árvore." << endl;
-    }
-
-    // Verifica se o grafo possui aresta ponte
-    try
-    {
-        cout << "Aresta Ponte: " << (grafo->possuiPonte() ? "Sim" : "Não") << endl;
+        string valor = obtemPropriedade(cache, "perfil", [&]() { return grafo->getPerfil().serializa(); });
+        if (!perfil.desserializa(valor))
+        {
+            perfil = grafo->getPerfil(); // Entrada de cache inválida: recalcula
+            cache.grava("perfil", perfil.serializa());
+        }
     }
     catch (...)
     {
-        cout << "Erro ao verificar se o grafo possui aresta ponte." << endl;
+        cout << "Erro ao calcular as propriedades do grafo." << endl;
+        cout << "========================================" << endl;
+        return;
     }
 
-    // Verifica se o grafo possui vértice de articulação
-    try
+    cout << "Arestas: " << perfil.numArestas << endl;
+    cout << "Grau mínimo/médio/máximo: " << perfil.grauMinimo << " / " << perfil.grauMedio << " / " << perfil.grauMaximo << endl;
+    if (grafo->ehDirecionado())
     {
-        cout << "Vértice de Articulação: " << (grafo->possuiArticulacao() ? "Sim" : "Não") << endl;
+        cout << "Componentes fracamente conexas: " << perfil.componentes << endl;
+        cout << "Componentes fortemente conexas: " << perfil.componentesFortes << endl;
     }
-    catch (...)
+    else
     {
-        cout << "Erro ao verificar se o grafo possui vértice de articulação." << endl;
+        cout << "Componentes conexas: " << perfil.componentes << endl;
     }
+    cout << "Completo: " << simNao(perfil.completo) << endl;
+    cout << "Bipartido: " << simNao(perfil.bipartido()) << endl;
+    cout << "Árvore: " << simNao(perfil.arvore) << endl;
+    cout << "Aresta Ponte: " << simNao(perfil.numPontes > 0) << endl;
+    cout << "Vértice de Articulação: " << simNao(perfil.numArticulacoes > 0) << endl;
 
     cout << "========================================" << endl;
 }
@@ -149,8 +218,10 @@ int main(int argc, char *argv[])
     bool executarGuloso = false;
     bool executarRandomizado = false;
     bool executarReativo = false;
-    int idNoRemover = -1;
-    int idNoAdicionar = -1;
+    bool executarHierarquia = false;
+    bool executarExcentricidades = false;
+    long long idNoRemover = -1;
+    long long idNoAdicionar = -1;
 
     // Verificar se há a opção de executar algoritmos gulosos (-g)
     if (argc == 4 && string(argv[3]) == "-g")
@@ -168,14 +239,14 @@ int main(int argc, char *argv[])
     if (argc == 5 && string(argv[3]) == "-r")
     {
         removerNo = true;
-        idNoRemover = stoi(argv[4]);  // Pegando corretamente o ID do nó para remoção
+        idNoRemover = stoll(argv[4]);  // ID do nó como no arquivo de entrada
     }
 
     //Verificar se há a opção de adicionar nó (-a <idNo>)
     if (argc == 5 && string(argv[3]) == "-a")
     {
         adicionarNo = true;
-        idNoAdicionar = stoi(argv[4]);  // Pegando corretamente o ID do nó para adição
+        idNoAdicionar = stoll(argv[4]);  // ID do nó como no arquivo de entrada
     }
 
     // Verificar flags para cada algoritmo
@@ -189,6 +260,12 @@ int main(int argc, char *argv[])
         else if (string(argv[3]) == "-r") {
             executarReativo = true;
         }
+        else if (string(argv[3]) == "-ch") {
+            executarHierarquia = true;
+        }
+        else if (string(argv[3]) == "-ex") {
+            executarExcentricidades = true;
+        }
     }
 
     Grafo *grafo = nullptr;
@@ -199,229 +276,230 @@ int main(int argc, char *argv[])
         cout << "Carregando grafo como matriz..." << endl;
         grafo = new GrafoMatriz(0, true, true, true);
         grafo->carregaGrafo(arquivo);
-
-        if (executarRandomizado)
-        {
-            cout << "\n========== Algoritmo Guloso Randomizado ==========\n";
-            int tamanhoCobertura;
-            
-            cout << "Executando construção gulosa randomizada...\n";
-            float alpha = 0.5; // valor entre 0 e 1
-            int maxIteracoes = 100;
-            int* coberturaRandomizada = grafo->coberturaArestas(alpha, maxIteracoes, &tamanhoCobertura);
-            
-            if (coberturaRandomizada != nullptr) {
-                cout << "Tamanho da cobertura (randomizada): " << tamanhoCobertura << "\nVértices na cobertura: ";
-                for(int i = 0; i < tamanhoCobertura; i++) {
-                    cout << coberturaRandomizada[i] + 1 << " ";
-                }
-                cout << "\n";
-                delete[] coberturaRandomizada;
-            } else {
-                cout << "Não foi possível encontrar uma cobertura randomizada.\n";
-            }
-            
-            cout << "=============================================\n\n";
-        }
-        else if (executarGuloso)
+    }
+    // Se for lista de adjacência
+    else if (tipoGrafo == "-l")
+    {
+        cout << "Carregando grafo como lista..." << endl;
+        grafo = new GrafoLista(0, true, true, true);
+        grafo->carregaGrafo(arquivo);
+    }
+    // Se for carregar a partir de um arquivo de configuração (lido uma única vez)
+    else if (tipoGrafo == "-c")
+    {
+        DadosGrafo dados;
+        if (!Importador::carrega(arquivo, dados))
         {
-            cout << "\n========== Algoritmo Guloso ==========\n";
-            int tamanhoCobertura;
-            
-            cout << "Executando algoritmo guloso...\n";
-            int* coberturaGulosa = grafo->construcaoGulosa(&tamanhoCobertura);
-            
-            if (coberturaGulosa != nullptr) {
-                cout << "Tamanho da cobertura (gulosa): " << tamanhoCobertura << "\nVértices na cobertura: ";
-                for(int i = 0; i < tamanhoCobertura; i++) {
-                    cout << coberturaGulosa[i] + 1 << " ";
-                }
-                cout << "\n";
-                delete[] coberturaGulosa;
-            } else {
-                cout << "Não foi possível encontrar uma cobertura gulosa.\n";
-            }
-            
-            cout << "===================================\n\n";
+            return 1;
         }
 
-        if (executarReativo)
+        if (dados.estrutura == "matriz")
         {
-            cout << "\n========== Algoritmo Reativo ==========\n";
-            int tamanhoCobertura;
-            int maxIteracoes = 100;
-            int tamanhoListaAlpha = 5;
-            
-            cout << "Executando construção gulosa reativa...\n";
-            int* coberturaReativa = grafo->coberturaArestasReativa(maxIteracoes, tamanhoListaAlpha, &tamanhoCobertura);
-            
-            if (coberturaReativa != nullptr) {
-                cout << "Tamanho da cobertura (reativa): " << tamanhoCobertura << "\nVértices na cobertura: ";
-                for(int i = 0; i < tamanhoCobertura; i++) {
-                    cout << coberturaReativa[i] + 1 << " "; // +1 para ajustar índice baseado em 0
-                }
-                cout << "\n";
-                delete[] coberturaReativa;
-            } else {
-                cout << "Não foi possível encontrar uma cobertura reativa.\n";
-            }
-            
-            cout << "====================================\n\n";
+            grafo = new GrafoMatriz(0, true, true, true);
         }
-
-        if (removerNo)
+        else if (dados.estrutura == "lista")
         {
-            cout << "Removendo nó " << idNoRemover << "...\n";
-            grafo->deleta_no(idNoRemover);
+            grafo = new GrafoLista(0, true, true, true);
         }
-        if(adicionarNo)
+        else
         {
-            cout << "Adicionando nó " << idNoAdicionar << "...\n";
-            grafo->adicionaNo(idNoAdicionar);
+            cerr << "Estrutura desconhecida no arquivo." << endl;
+            return 1;
         }
 
-        imprimeDescricao(grafo);
+        grafo->constroiGrafo(dados);
+        cout << "Novo grafo configurado como " << dados.estrutura << "." << endl;
     }
-    // Se for lista de adjacência
-    else if (tipoGrafo == "-l")
+    // Caso a opção passada seja inválida
+    else
     {
-        cout << "Carregando grafo como lista..." << endl;
-        grafo = new GrafoLista(0, true, true, true);
-        grafo->carregaGrafo(arquivo);
+        cerr << "Tipo de execução inválido." << endl;
+        return 1;
+    }
 
-        if (executarRandomizado)
-        {
-            cout << "\n========== Algoritmo Guloso Randomizado ==========\n";
-            int tamanhoCobertura;
-            
-            cout << "Executando construção gulosa randomizada...\n";
-            float alpha = 0.5; // valor entre 0 e 1
-            int maxIteracoes = 100;
-            int* coberturaRandomizada = grafo->coberturaArestas(alpha, maxIteracoes, &tamanhoCobertura);
-            
-            if (coberturaRandomizada != nullptr) {
-                cout << "Tamanho da cobertura (randomizada): " << tamanhoCobertura << "\nVértices na cobertura: ";
-                for(int i = 0; i < tamanhoCobertura; i++) {
-                    cout << coberturaRandomizada[i] + 1 << " ";
-                }
-                cout << "\n";
-                delete[] coberturaRandomizada;
-            } else {
-                cout << "Não foi possível encontrar uma cobertura randomizada.\n";
+    // Semente fixa: as coberturas são reprodutíveis e podem ser reaproveitadas do cache
+    const unsigned int semente = 1;
+    srand(semente);
+    CacheAnalise cache = abreCache(grafo);
+    vector<int> cobertura;
+
+    if (executarRandomizado)
+    {
+        cout << "\n========== Algoritmo Guloso Randomizado ==========\n";
+        
+        cout << "Executando construção gulosa randomizada...\n";
+        float alpha = 0.5; // valor entre 0 e 1
+        int maxIteracoes = 100;
+        string chave = "cobertura.randomizada.alpha_" + to_string(alpha) + ".iteracoes_" + to_string(maxIteracoes) +
+                       ".semente_" + to_string(semente);
+        
+        if (obtemCobertura(cache, chave, [&](int *tamanho) { return grafo->coberturaArestas(alpha, maxIteracoes, tamanho); }, cobertura)) {
+            cout << "Tamanho da cobertura (randomizada): " << cobertura.size() << "\nVértices na cobertura: ";
+            for(size_t i = 0; i < cobertura.size(); i++) {
+                cout << grafo->getIdExterno(cobertura[i]) << " ";
             }
-            
-            cout << "=============================================\n\n";
+            cout << "\n";
+        } else {
+            cout << "Não foi possível encontrar uma cobertura randomizada.\n";
         }
-        else if (executarGuloso)
-        {
-            cout << "\n========== Algoritmo Guloso ==========\n";
-            int tamanhoCobertura;
-            
-            cout << "Executando algoritmo guloso...\n";
-            int* coberturaGulosa = grafo->construcaoGulosa(&tamanhoCobertura);
-            
-            if (coberturaGulosa != nullptr) {
-                cout << "Tamanho da cobertura (gulosa): " << tamanhoCobertura << "\nVértices na cobertura: ";
-                for(int i = 0; i < tamanhoCobertura; i++) {
-                    cout << coberturaGulosa[i] + 1 << " ";
-                }
-                cout << "\n";
-                delete[] coberturaGulosa;
-            } else {
-                cout << "Não foi possível encontrar uma cobertura gulosa.\n";
+        
+        cout << "=============================================\n\n";
+    }
+    else if (executarGuloso)
+    {
+        cout << "\n========== Algoritmo Guloso ==========\n";
+        
+        cout << "Executando algoritmo guloso...\n";
+        
+        if (obtemCobertura(cache, "cobertura.gulosa", [&](int *tamanho) { return grafo->construcaoGulosa(tamanho); }, cobertura)) {
+            cout << "Tamanho da cobertura (gulosa): " << cobertura.size() << "\nVértices na cobertura: ";
+            for(size_t i = 0; i < cobertura.size(); i++) {
+                cout << grafo->getIdExterno(cobertura[i]) << " ";
             }
-            
-            cout << "===================================\n\n";
+            cout << "\n";
+        } else {
+            cout << "Não foi possível encontrar uma cobertura gulosa.\n";
         }
+        
+        cout << "===================================\n\n";
+    }
 
-        if (executarReativo)
-        {
-            cout << "\n========== Algoritmo Reativo ==========\n";
-            int tamanhoCobertura;
-            int maxIteracoes = 100;
-            int tamanhoListaAlpha = 5;
-            
-            cout << "Executando construção gulosa reativa...\n";
-            int* coberturaReativa = grafo->coberturaArestasReativa(maxIteracoes, tamanhoListaAlpha, &tamanhoCobertura);
-            
-            if (coberturaReativa != nullptr) {
-                cout << "Tamanho da cobertura (reativa): " << tamanhoCobertura << "\nVértices na cobertura: ";
-                for(int i = 0; i < tamanhoCobertura; i++) {
-                    cout << coberturaReativa[i] + 1 << " "; // +1 para ajustar índice baseado em 0
-                }
-                cout << "\n";
-                delete[] coberturaReativa;
-            } else {
-                cout << "Não foi possível encontrar uma cobertura reativa.\n";
+    if (executarReativo)
+    {
+        cout << "\n========== Algoritmo Reativo ==========\n";
+        int maxIteracoes = 100;
+        int tamanhoListaAlpha = 5;
+        string chave = "cobertura.reativa.alphas_" + to_string(tamanhoListaAlpha) + ".iteracoes_" + to_string(maxIteracoes) +
+                       ".semente_" + to_string(semente);
+        
+        cout << "Executando construção gulosa reativa...\n";
+        
+        if (obtemCobertura(cache, chave, [&](int *tamanho) { return grafo->coberturaArestasReativa(maxIteracoes, tamanhoListaAlpha, tamanho); }, cobertura)) {
+            cout << "Tamanho da cobertura (reativa): " << cobertura.size() << "\nVértices na cobertura: ";
+            for(size_t i = 0; i < cobertura.size(); i++) {
+                cout << grafo->getIdExterno(cobertura[i]) << " ";
             }
-            
-            cout << "====================================\n\n";
-        }
-
-        if (removerNo)
-        {
-            cout << "Removendo nó " << idNoRemover << "...\n";
-            grafo->deleta_no(idNoRemover);
+            cout << "\n";
+        } else {
+            cout << "Não foi possível encontrar uma cobertura reativa.\n";
         }
+        
+        cout << "====================================\n\n";
+    }
 
-        if(adicionarNo)
-        {
-            cout << "Adicionando nó " << idNoAdicionar << "...\n";
-            grafo->adicionaNo(idNoAdicionar);
+    if (executarHierarquia)
+    {
+        cout << "\n========== Hierarquia de Contração ==========\n";
+        HierarquiaContracao hierarquia;
+        if (hierarquia.prepara(*grafo)) {
+            if (hierarquia.getTempoConstrucao() > 0) {
+                cout << "Tempo de construção: " << hierarquia.getTempoConstrucao() * 1000 << " ms\n";
+            } else {
+                cout << "Índice lido do cache.\n";
+            }
+            cout << "Atalhos: " << hierarquia.getNumAtalhos() << " (núcleo sem contrair: " << hierarquia.getTamanhoNucleo() << " vértices)\n";
+            cout << "Tamanho do índice: " << hierarquia.getTamanho() / 1024 << " KB\n";
+
+            // Latência medida sobre pares aleatórios de vértices (a semente fixa torna os pares reprodutíveis)
+            vector<double> latencias;
+            int numIndices = grafo->getNumIndices();
+            for (int i = 0; i < 1000 && grafo->getOrdem() > 0; i++) {
+                int origem = rand() % numIndices;
+                int destino = rand() % numIndices;
+                if (grafo->estaRemovido(origem) || grafo->estaRemovido(destino)) {
+                    continue;
+                }
+                chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+                hierarquia.distancia(origem, destino);
+                latencias.push_back(chrono::duration<double, micro>(chrono::steady_clock::now() - inicio).count());
+            }
+            if (!latencias.empty()) {
+                sort(latencias.begin(), latencias.end());
+                cout << "Latência das consultas (" << latencias.size() << " pares): p50 " << latencias[latencias.size() / 2]
+                     << " us, p90 " << latencias[latencias.size() * 9 / 10] << " us, p99 " << latencias[latencias.size() * 99 / 100] << " us\n";
+            }
+        } else {
+            cout << "Não foi possível construir a hierarquia de contração.\n";
         }
 
-        imprimeDescricao(grafo);
+        cout << "=============================================\n\n";
     }
-    // Se for carregar a partir de um arquivo de configuração
-    else if (tipoGrafo == "-c")
+
+    if (executarExcentricidades)
     {
-        ifstream descFile(arquivo);
-        if (!descFile.is_open())
-        {
-            cerr << "Erro ao abrir arquivo de configuração: " << arquivo << endl;
-            return 1;
+        cout << "\n========== Distâncias em Arestas ==========\n";
+        BuscaLarguraMultipla busca;
+        busca.prepara(*grafo);
+
+        chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+        int diametro = busca.diametro();
+        double tempo = chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+        cout << "Diâmetro (dupla varredura + iFUB): " << diametro << " (" << busca.getNumBuscas() << " buscas, " << tempo << " ms)\n";
+
+        vector<int> excentricidade;
+        vector<double> proximidade;
+        inicio = chrono::steady_clock::now();
+        busca.excentricidades(excentricidade, &proximidade);
+        tempo = chrono::duration<double, milli>(chrono::steady_clock::now() - inicio).count();
+        cout << "Excentricidades exatas (" << busca.getNumBuscas() << " buscas em lotes de " << BuscaLarguraMultipla::LARGURA
+             << "): " << tempo << " ms\n";
+
+        int raio = -1;
+        int numCentro = 0;
+        int maisProximo = -1;
+        for (int v = 0; v < grafo->getNumIndices(); v++) {
+            if (grafo->estaRemovido(v)) {
+                continue;
+            }
+            if (excentricidade[v] > 0 && (raio == -1 || excentricidade[v] < raio)) {
+                raio = excentricidade[v];
+                numCentro = 0;
+            }
+            numCentro += excentricidade[v] > 0 && excentricidade[v] == raio;
+            if (maisProximo == -1 || proximidade[v] > proximidade[maisProximo]) {
+                maisProximo = v;
+            }
+        }
+        if (raio != -1) {
+            cout << "Raio (entre os vértices que alcançam outros): " << raio << " (" << numCentro << " no centro)\n";
+        }
+        if (maisProximo != -1) {
+            cout << "Maior proximidade: vértice " << grafo->getIdExterno(maisProximo) << " (" << proximidade[maisProximo] << ")\n";
         }
 
-        string tipoEstrutura;
-        descFile >> tipoEstrutura;
+        cout << "===========================================\n\n";
+    }
 
-        if (tipoEstrutura == "matriz")
-        {
-            grafo = new GrafoMatriz(0, true, true, true);
-        }
-        else if (tipoEstrutura == "lista")
+    if (removerNo)
+    {
+        cout << "Removendo nó " << idNoRemover << "...\n";
+        int indice = grafo->getIndice(idNoRemover);
+        if (indice == -1)
         {
-            grafo = new GrafoLista(0, true, true, true);
+            cout << "Erro: não há nó com ID " << idNoRemover << "." << endl;
         }
         else
         {
-            cerr << "Estrutura desconhecida no arquivo." << endl;
-            return 1;
+            grafo->deleta_no(indice);
         }
+    }
 
-        grafo->novoGrafo(arquivo);
-
-        if (removerNo)
+    if(adicionarNo)
+    {
+        cout << "Adicionando nó ligado a " << idNoAdicionar << "...\n";
+        int indice = grafo->getIndice(idNoAdicionar);
+        if (indice == -1)
         {
-            cout << "Removendo nó " << idNoRemover << "...\n";
-            grafo->deleta_no(idNoRemover);
+            cout << "Erro: não há nó com ID " << idNoAdicionar << "." << endl;
         }
-
-        if(adicionarNo)
+        else
         {
-            cout << "Adicionando nó " << idNoAdicionar << "...\n";
-            grafo->adicionaNo(idNoAdicionar);
+            grafo->adicionaNo(indice);
         }
-
-        imprimeDescricao(grafo);
-    }
-    // Caso a opção passada seja inválida
-    else
-    {
-        cerr << "Tipo de execução inválido." << endl;
-        return 1;
     }
 
+    imprimeDescricao(grafo);
+
     delete grafo;
     return 0;
 }
@@ -0,0 +1,65 @@
+/**
+ * @file Arena.cpp
+ * @brief Implementação do alocador em blocos para objetos de tamanho fixo.
+ */
+
+#include "../include/Arena.h"
+#include <new>
+
+using namespace std;
+
+Arena::Arena(size_t tamanhoObjeto, int objetosPorBloco)
+    : porBloco(objetosPorBloco), usadasNoBloco(objetosPorBloco), livres(nullptr)
+{
+    // Cada posição precisa comportar o ponteiro da lista livre e manter o alinhamento máximo
+    size_t alinhamento = alignof(max_align_t);
+    tamanho = tamanhoObjeto < sizeof(void *) ? sizeof(void *) : tamanhoObjeto;
+    tamanho = (tamanho + alinhamento - 1) / alinhamento * alinhamento;
+}
+
+Arena::~Arena()
+{
+    liberaTudo();
+}
+
+void *Arena::aloca()
+{
+    if (livres != nullptr)
+    {
+        void *posicao = livres;
+        livres = *static_cast<void **>(livres);
+        return posicao;
+    }
+    if (usadasNoBloco == porBloco)
+    {
+        blocos.push_back(static_cast<char *>(::operator new(tamanho * porBloco)));
+        usadasNoBloco = 0;
+    }
+    return blocos.back() + tamanho * usadasNoBloco++;
+}
+
+void Arena::libera(void *objeto)
+{
+    if (objeto == nullptr)
+    {
+        return;
+    }
+    *static_cast<void **>(objeto) = livres;
+    livres = objeto;
+}
+
+void Arena::liberaTudo()
+{
+    for (size_t i = 0; i < blocos.size(); i++)
+    {
+        ::operator delete(blocos[i]);
+    }
+    blocos.clear();
+    usadasNoBloco = porBloco;
+    livres = nullptr;
+}
+
+int Arena::getNumBlocos() const
+{
+    return static_cast<int>(blocos.size());
+}
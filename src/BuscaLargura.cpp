@@ -0,0 +1,253 @@
+/**
+ * @file BuscaLargura.cpp
+ * @brief Implementação da busca em largura por fronteiras, com troca entre os sentidos descendente e ascendente.
+ */
+
+#include "../include/BuscaLargura.h"
+#include "../include/Grafo.h"
+#include <algorithm>
+#include <iostream>
+
+using namespace std;
+
+BuscaLargura::BuscaLargura()
+    : ordem(0), vivos(0), direcionado(false), inicioFila(0), tamanhoFila(0), niveis(0), niveisAscendentes(0)
+{
+}
+
+void BuscaLargura::prepara(Grafo &grafo)
+{
+    saida = grafo.visaoCSR();
+    ordem = saida.ordem;
+    direcionado = grafo.ehDirecionado();
+    removido.assign(ordem, 0);
+    vivos = 0;
+    for (int v = 0; v < ordem; v++)
+    {
+        removido[v] = grafo.estaRemovido(v);
+        vivos += !removido[v];
+    }
+
+    entrada = direcionado ? grafo.transposta() : VisaoCSR(); // Guardada no grafo: preparações seguidas não a remontam
+    simetrica = VisaoCSR();
+
+    fila.assign(max(ordem, 1), 0);
+    inicioFila = tamanhoFila = 0;
+    fronteira.assign((ordem + 63) / 64, 0);
+    proxima.assign(fronteira.size(), 0);
+    niveis = niveisAscendentes = 0;
+}
+
+const VisaoCSR &BuscaLargura::naoDirecionado()
+{
+    if (!direcionado)
+    {
+        return saida;
+    }
+    if (simetrica.inicio.empty())
+    {
+        simetrica = saida.simetrica();
+    }
+    return simetrica;
+}
+
+int BuscaLargura::desenfileira()
+{
+    int v = fila[inicioFila];
+    if (++inicioFila == fila.size())
+    {
+        inicioFila = 0;
+    }
+    tamanhoFila--;
+    return v;
+}
+
+int BuscaLargura::percorre(const VisaoCSR &frente, const VisaoCSR &tras, int origem, vector<int> &nivel, long long &pendentes,
+                           vector<int> *rotulo, int componente)
+{
+    nivel[origem] = 0;
+    if (rotulo != nullptr)
+    {
+        (*rotulo)[origem] = componente;
+    }
+    pendentes -= frente.grau(origem);
+    enfileira(origem);
+    int alcancados = 1;
+    int tamanhoFronteira = 1;
+    long long arestasFronteira = frente.grau(origem);
+    bool ascendente = false;
+
+    for (int atual = 0; tamanhoFronteira > 0; atual++)
+    {
+        niveis++;
+        if (!ascendente && arestasFronteira > pendentes / ALFA && tamanhoFronteira >= vivos / BETA)
+        {
+            // A fronteira já toca boa parte do que falta: passa para o mapa de bits. Com a fronteira pequena (fim da
+            // busca em grafos de diâmetro grande), a varredura de todos os vértices custaria mais que o nível inteiro
+            ascendente = true;
+            fill(fronteira.begin(), fronteira.end(), 0);
+            while (tamanhoFila > 0)
+            {
+                int v = desenfileira();
+                fronteira[v >> 6] |= uint64_t(1) << (v & 63);
+            }
+        }
+        else if (ascendente && tamanhoFronteira < vivos / BETA)
+        {
+            ascendente = false;
+            for (size_t palavra = 0; palavra < fronteira.size(); palavra++)
+            {
+                for (uint64_t bits = fronteira[palavra]; bits != 0; bits &= bits - 1)
+                {
+                    enfileira(static_cast<int>(palavra * 64) + __builtin_ctzll(bits));
+                }
+            }
+        }
+
+        int novos = 0;
+        arestasFronteira = 0;
+        if (ascendente)
+        {
+            niveisAscendentes++;
+            fill(proxima.begin(), proxima.end(), 0);
+            for (int v = 0; v < ordem; v++)
+            {
+                if (nivel[v] != -1 || removido[v])
+                {
+                    continue;
+                }
+                for (int k = tras.inicio[v]; k < tras.inicio[v + 1]; k++)
+                {
+                    int u = tras.vizinhos[k];
+                    if (fronteira[u >> 6] & (uint64_t(1) << (u & 63)))
+                    {
+                        nivel[v] = atual + 1;
+                        if (rotulo != nullptr)
+                        {
+                            (*rotulo)[v] = componente;
+                        }
+                        proxima[v >> 6] |= uint64_t(1) << (v & 63);
+                        novos++;
+                        arestasFronteira += frente.grau(v);
+                        break;
+                    }
+                }
+            }
+            fronteira.swap(proxima);
+        }
+        else
+        {
+            for (int i = 0; i < tamanhoFronteira; i++)
+            {
+                int u = desenfileira();
+                for (int k = frente.inicio[u]; k < frente.inicio[u + 1]; k++)
+                {
+                    int w = frente.vizinhos[k];
+                    if (nivel[w] == -1)
+                    {
+                        nivel[w] = atual + 1;
+                        if (rotulo != nullptr)
+                        {
+                            (*rotulo)[w] = componente;
+                        }
+                        enfileira(w);
+                        novos++;
+                        arestasFronteira += frente.grau(w);
+                    }
+                }
+            }
+        }
+        pendentes -= arestasFronteira;
+        alcancados += novos;
+        tamanhoFronteira = novos;
+    }
+    return alcancados;
+}
+
+int BuscaLargura::distancias(int origem, vector<int> &nivel)
+{
+    niveis = niveisAscendentes = 0;
+    nivel.assign(ordem, -1);
+    if (origem < 0 || origem >= ordem || removido[origem])
+    {
+        cout << "Erro: ID do nó inválido. Ordem atual: " << vivos << endl;
+        return 0;
+    }
+    long long pendentes = saida.numEntradas();
+    return percorre(saida, direcionado ? entrada : saida, origem, nivel, pendentes, nullptr, 0);
+}
+
+int BuscaLargura::rotulaComponentes(vector<int> &rotulo, vector<int> &nivel, vector<int> *tamanhos)
+{
+    niveis = niveisAscendentes = 0;
+    const VisaoCSR &adjacencia = naoDirecionado();
+    nivel.assign(ordem, -1);
+    rotulo.assign(ordem, -1);
+    if (tamanhos != nullptr)
+    {
+        tamanhos->clear();
+    }
+
+    // As arestas pendentes são as de todas as componentes ainda não visitadas, o que mantém as buscas das
+    // componentes pequenas no sentido descendente
+    long long pendentes = adjacencia.numEntradas();
+    int numComponentes = 0;
+    for (int raiz = 0; raiz < ordem; raiz++)
+    {
+        if (removido[raiz] || nivel[raiz] != -1)
+        {
+            continue;
+        }
+        int tamanho = percorre(adjacencia, adjacencia, raiz, nivel, pendentes, &rotulo, numComponentes);
+        if (tamanhos != nullptr)
+        {
+            tamanhos->push_back(tamanho);
+        }
+        numComponentes++;
+    }
+    return numComponentes;
+}
+
+int BuscaLargura::componentes(vector<int> &rotulo, vector<int> *tamanhos)
+{
+    vector<int> nivel;
+    return rotulaComponentes(rotulo, nivel, tamanhos);
+}
+
+bool BuscaLargura::bipartido(vector<int> *cor, int *componentesBipartidas)
+{
+    vector<int> rotulo;
+    vector<int> nivel;
+    int numComponentes = rotulaComponentes(rotulo, nivel, nullptr);
+    const VisaoCSR &adjacencia = naoDirecionado();
+
+    vector<char> bipartida(numComponentes, 1);
+    for (int u = 0; u < ordem; u++)
+    {
+        for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
+        {
+            if ((nivel[u] & 1) == (nivel[adjacencia.vizinhos[k]] & 1))
+            {
+                bipartida[rotulo[u]] = 0;
+            }
+        }
+    }
+
+    int numBipartidas = static_cast<int>(count(bipartida.begin(), bipartida.end(), 1));
+    if (cor != nullptr)
+    {
+        cor->assign(ordem, -1);
+        for (int v = 0; v < ordem; v++)
+        {
+            if (!removido[v])
+            {
+                (*cor)[v] = nivel[v] & 1;
+            }
+        }
+    }
+    if (componentesBipartidas != nullptr)
+    {
+        *componentesBipartidas = numBipartidas;
+    }
+    return numBipartidas == numComponentes;
+}
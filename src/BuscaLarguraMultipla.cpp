@@ -0,0 +1,306 @@
+/**
+ * @file BuscaLarguraMultipla.cpp
+ * @brief Implementação das buscas em largura simultâneas: lotes com máscaras de bits, excentricidades e iFUB.
+ */
+
+#include "../include/BuscaLarguraMultipla.h"
+#include "../include/Grafo.h"
+#include "../include/Paralelo.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+using namespace std;
+
+const int BuscaLarguraMultipla::LARGURA;
+
+namespace
+{
+    /// Planos dos contadores verticais de buscaLote (bits de uma contagem de vértices).
+    const int NUM_PLANOS = 31;
+
+    /// Vetores de um lote de buscas, reaproveitados de um lote para o seguinte pela mesma thread.
+    struct EstadoLote
+    {
+        vector<uint64_t> visto;     ///< Buscas que já alcançaram cada vértice.
+        vector<uint64_t> fronteira; ///< Buscas que têm cada vértice no nível atual.
+        vector<uint64_t> proxima;   ///< Buscas que chegam a cada vértice no próximo nível.
+        vector<int> ativos;         ///< Vértices com fronteira não vazia.
+        vector<int> novos;          ///< Vértices alcançados no próximo nível.
+    };
+
+    /**
+     * Executa até 64 buscas em largura juntas, a busca i no bit i. Um vértice entra na lista do próximo nível
+     * uma única vez, quando a primeira busca chega a ele; as demais só acrescentam bits à sua máscara.
+     * Preenche, por busca, a excentricidade, a soma das distâncias e o número de vértices alcançados.
+     */
+    void buscaLote(const VisaoCSR &adjacencia, const int *origens, int numOrigens, EstadoLote &estado,
+                   int *excentricidade, long long *soma, int *alcance)
+    {
+        int n = adjacencia.ordem;
+        estado.visto.assign(n, 0);
+        estado.fronteira.assign(n, 0);
+        estado.proxima.assign(n, 0);
+        estado.ativos.clear();
+        for (int i = 0; i < numOrigens; i++)
+        {
+            int origem = origens[i];
+            uint64_t bit = uint64_t(1) << i;
+            if (estado.fronteira[origem] == 0)
+            {
+                estado.ativos.push_back(origem);
+            }
+            estado.visto[origem] |= bit;
+            estado.fronteira[origem] |= bit;
+            excentricidade[i] = 0;
+            soma[i] = 0;
+            alcance[i] = 1;
+        }
+
+        for (int nivel = 1; !estado.ativos.empty(); nivel++)
+        {
+            estado.novos.clear();
+            for (int u : estado.ativos)
+            {
+                uint64_t mascara = estado.fronteira[u];
+                for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
+                {
+                    int w = adjacencia.vizinhos[k];
+                    uint64_t chegam = mascara & ~estado.visto[w];
+                    if (chegam != 0)
+                    {
+                        if (estado.proxima[w] == 0)
+                        {
+                            estado.novos.push_back(w);
+                        }
+                        estado.proxima[w] |= chegam;
+                        estado.visto[w] |= chegam;
+                    }
+                }
+            }
+            for (int u : estado.ativos)
+            {
+                estado.fronteira[u] = 0;
+            }
+            // Contadores verticais: o bit i do plano j é o bit j do número de vértices que a busca i alcançou
+            // neste nível. Somar uma máscara é uma soma binária com vai-um, feita para as 64 buscas de uma vez
+            uint64_t planos[NUM_PLANOS] = {};
+            uint64_t chegaram = 0;
+            for (int w : estado.novos)
+            {
+                uint64_t chegam = estado.proxima[w];
+                estado.proxima[w] = 0;
+                estado.fronteira[w] = chegam;
+                chegaram |= chegam;
+                for (int j = 0; chegam != 0; j++)
+                {
+                    uint64_t vaiUm = planos[j] & chegam;
+                    planos[j] ^= chegam;
+                    chegam = vaiUm;
+                }
+            }
+            for (; chegaram != 0; chegaram &= chegaram - 1)
+            {
+                int i = __builtin_ctzll(chegaram);
+                int quantidade = 0;
+                for (int j = 0; j < NUM_PLANOS; j++)
+                {
+                    quantidade |= static_cast<int>((planos[j] >> i) & 1) << j;
+                }
+                excentricidade[i] = nivel;
+                soma[i] += static_cast<long long>(nivel) * quantidade;
+                alcance[i] += quantidade;
+            }
+            estado.ativos.swap(estado.novos);
+        }
+    }
+}
+
+BuscaLarguraMultipla::BuscaLarguraMultipla() : ordem(0), vivos(0), direcionado(false), numBuscas(0)
+{
+}
+
+void BuscaLarguraMultipla::prepara(Grafo &grafo)
+{
+    adjacencia = grafo.visaoCSR();
+    ordem = adjacencia.ordem;
+    direcionado = grafo.ehDirecionado();
+    removido.assign(ordem, 0);
+    vivos = 0;
+    for (int v = 0; v < ordem; v++)
+    {
+        removido[v] = grafo.estaRemovido(v);
+        vivos += !removido[v];
+    }
+    numBuscas = 0;
+}
+
+void BuscaLarguraMultipla::calculaLotes(const vector<int> &origens, vector<int> &excentricidade, vector<long long> *somaDistancias,
+                                        vector<int> *alcance, int numThreads)
+{
+    int numOrigens = static_cast<int>(origens.size());
+    int numLotes = (numOrigens + LARGURA - 1) / LARGURA;
+    excentricidade.assign(numOrigens, 0);
+    numBuscas += numOrigens;
+    if (numLotes == 0)
+    {
+        return;
+    }
+
+    vector<long long> soma(numOrigens);
+    vector<int> alcancados(numOrigens);
+    atomic<int> proximo(0);
+    numThreads = min(Paralelo::resolveThreads(numThreads), numLotes);
+    Paralelo::executa(numThreads, numThreads, [&](int)
+    {
+        EstadoLote estado;
+        for (int lote = proximo++; lote < numLotes; lote = proximo++)
+        {
+            int inicio = lote * LARGURA;
+            buscaLote(adjacencia, &origens[inicio], min(LARGURA, numOrigens - inicio), estado,
+                      &excentricidade[inicio], &soma[inicio], &alcancados[inicio]);
+        }
+    });
+    if (somaDistancias != nullptr)
+    {
+        somaDistancias->swap(soma);
+    }
+    if (alcance != nullptr)
+    {
+        alcance->swap(alcancados);
+    }
+}
+
+void BuscaLarguraMultipla::excentricidades(vector<int> &excentricidade, vector<double> *proximidade, int numThreads)
+{
+    numBuscas = 0;
+    vector<int> origens;
+    origens.reserve(vivos);
+    for (int v = 0; v < ordem; v++)
+    {
+        if (!removido[v])
+        {
+            origens.push_back(v);
+        }
+    }
+
+    vector<int> excentricidadeOrigens;
+    vector<long long> soma;
+    vector<int> alcance;
+    calculaLotes(origens, excentricidadeOrigens, &soma, &alcance, numThreads);
+
+    excentricidade.assign(ordem, -1);
+    if (proximidade != nullptr)
+    {
+        proximidade->assign(ordem, 0);
+    }
+    for (size_t i = 0; i < origens.size(); i++)
+    {
+        int v = origens[i];
+        excentricidade[v] = excentricidadeOrigens[i];
+        if (proximidade != nullptr && soma[i] > 0)
+        {
+            double outros = alcance[i] - 1;
+            (*proximidade)[v] = outros / soma[i] * (outros / (vivos - 1));
+        }
+    }
+}
+
+int BuscaLarguraMultipla::buscaSimples(int origem, vector<int> &nivel, vector<int> &visitados, vector<int> *anterior)
+{
+    numBuscas++;
+    for (int v : visitados)
+    {
+        nivel[v] = -1;
+    }
+    visitados.clear();
+    nivel[origem] = 0;
+    visitados.push_back(origem);
+    if (anterior != nullptr)
+    {
+        (*anterior)[origem] = -1;
+    }
+    for (size_t i = 0; i < visitados.size(); i++)
+    {
+        int u = visitados[i];
+        for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
+        {
+            int w = adjacencia.vizinhos[k];
+            if (nivel[w] == -1)
+            {
+                nivel[w] = nivel[u] + 1;
+                visitados.push_back(w);
+                if (anterior != nullptr)
+                {
+                    (*anterior)[w] = u;
+                }
+            }
+        }
+    }
+    return visitados.back();
+}
+
+int BuscaLarguraMultipla::diametro(int numThreads)
+{
+    numBuscas = 0;
+    if (direcionado)
+    {
+        vector<int> excentricidade;
+        excentricidades(excentricidade, nullptr, numThreads);
+        return excentricidade.empty() ? 0 : max(0, *max_element(excentricidade.begin(), excentricidade.end()));
+    }
+
+    int limite = 0;
+    vector<char> tratado(ordem, 0);
+    vector<int> nivel(ordem, -1);
+    vector<int> anterior(ordem, -1);
+    vector<int> visitados;
+    for (int r = 0; r < ordem; r++)
+    {
+        if (removido[r] || tratado[r])
+        {
+            continue;
+        }
+        if (adjacencia.grau(r) == 0)
+        {
+            tratado[r] = 1; // Vértice isolado: excentricidade 0
+            continue;
+        }
+
+        // Dupla varredura: o vértice mais distante de r e o mais distante dele dão um caminho longo da componente
+        int a = buscaSimples(r, nivel, visitados, nullptr);
+        for (int v : visitados)
+        {
+            tratado[v] = 1;
+        }
+        int b = buscaSimples(a, nivel, visitados, &anterior);
+        int excentricidadeA = nivel[b];
+        limite = max(limite, excentricidadeA);
+
+        // Vértice central: o meio do caminho de a até b
+        int centro = b;
+        for (int passo = 0; passo < excentricidadeA / 2; passo++)
+        {
+            centro = anterior[centro];
+        }
+        int ultimo = buscaSimples(centro, nivel, visitados, nullptr);
+        int excentricidadeCentro = nivel[ultimo];
+
+        // visitados está em ordem de nível: cada nível é um trecho contíguo, tratado do mais distante ao centro
+        size_t fim = visitados.size();
+        for (int i = excentricidadeCentro; i > 0 && limite < 2 * i; i--)
+        {
+            size_t inicio = fim;
+            while (inicio > 0 && nivel[visitados[inicio - 1]] == i)
+            {
+                inicio--;
+            }
+            vector<int> camada(visitados.begin() + inicio, visitados.begin() + fim);
+            vector<int> excentricidade;
+            calculaLotes(camada, excentricidade, nullptr, nullptr, numThreads);
+            limite = max(limite, *max_element(excentricidade.begin(), excentricidade.end()));
+            fim = inicio;
+        }
+    }
+    return limite;
+}
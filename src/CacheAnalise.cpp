@@ -0,0 +1,190 @@
+/**
+ * @file CacheAnalise.cpp
+ * @brief Implementação do cache persistente de análises.
+ */
+
+#include "../include/CacheAnalise.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sys/stat.h>
+#ifdef _WIN32
+#include <direct.h>
+#endif
+
+using namespace std;
+
+/// Cabeçalho dos arquivos de cache. A versão deve mudar sempre que uma análise passar a produzir outro
+/// resultado para o mesmo grafo, para que as entradas antigas sejam descartadas.
+static const char *CABECALHO_CACHE = "# cache de analise v2";
+
+static const unsigned long long PRIMO1 = 0x9E3779B185EBCA87ULL;
+static const unsigned long long PRIMO2 = 0xC2B2AE3D27D4EB4FULL;
+
+/// Mistura uma palavra de 64 bits no hash (rodada no estilo xxHash).
+static inline unsigned long long misturaHash(unsigned long long h, unsigned long long x)
+{
+    h ^= x * PRIMO2;
+    h = (h << 31) | (h >> 33);
+    return h * PRIMO1;
+}
+
+static inline unsigned long long bitsReal(float valor)
+{
+    unsigned int bits;
+    memcpy(&bits, &valor, sizeof(bits));
+    return bits;
+}
+
+static bool criaDiretorio(const string &diretorio)
+{
+#ifdef _WIN32
+    int resultado = _mkdir(diretorio.c_str());
+#else
+    int resultado = mkdir(diretorio.c_str(), 0755);
+#endif
+    struct stat info;
+    return resultado == 0 || (stat(diretorio.c_str(), &info) == 0 && (info.st_mode & S_IFDIR));
+}
+
+string CacheAnalise::caminhoArquivo(unsigned long long impressao, const string &extensao)
+{
+    if (getenv("GRAFO_SEM_CACHE") != nullptr)
+    {
+        return "";
+    }
+
+    const char *diretorio = getenv("GRAFO_CACHE_DIR");
+    string dir = diretorio != nullptr ? diretorio : ".cache_grafos";
+    if (!criaDiretorio(dir))
+    {
+        cerr << "Aviso: não foi possível criar o diretório de cache " << dir << "; cache desativado." << endl;
+        return "";
+    }
+    return dir + "/" + impressaoHex(impressao) + extensao;
+}
+
+CacheAnalise::CacheAnalise(unsigned long long impressao, const string &representacao, bool ativo)
+    : representacao(representacao), ativo(ativo)
+{
+    if (!this->ativo)
+    {
+        return;
+    }
+    caminho = caminhoArquivo(impressao, ".cache");
+    if (caminho.empty())
+    {
+        this->ativo = false;
+        return;
+    }
+
+    ifstream file(caminho);
+    if (!file.is_open())
+    {
+        return;
+    }
+    string linha;
+    if (!getline(file, linha) || linha != CABECALHO_CACHE)
+    {
+        return; // Formato antigo ou arquivo corrompido: ignora o conteúdo
+    }
+    while (getline(file, linha))
+    {
+        size_t separador = linha.find('=');
+        if (separador != string::npos)
+        {
+            entradas[linha.substr(0, separador)] = linha.substr(separador + 1);
+        }
+    }
+}
+
+bool CacheAnalise::obtem(const string &chave, string &valor) const
+{
+    if (!ativo)
+    {
+        return false;
+    }
+    map<string, string>::const_iterator it = entradas.find(representacao + "." + chave);
+    if (it == entradas.end())
+    {
+        return false;
+    }
+    valor = it->second;
+    return true;
+}
+
+void CacheAnalise::grava(const string &chave, const string &valor)
+{
+    if (!ativo)
+    {
+        return;
+    }
+    entradas[representacao + "." + chave] = valor;
+    salva();
+}
+
+void CacheAnalise::salva()
+{
+    // Grava em um arquivo temporário e renomeia, para não deixar um cache pela metade
+    string temporario = caminho + ".tmp";
+    {
+        ofstream file(temporario, ios::out | ios::trunc);
+        if (!file.is_open())
+        {
+            return;
+        }
+        file << CABECALHO_CACHE << '\n';
+        for (map<string, string>::const_iterator it = entradas.begin(); it != entradas.end(); ++it)
+        {
+            file << it->first << '=' << it->second << '\n';
+        }
+    }
+    remove(caminho.c_str());
+    rename(temporario.c_str(), caminho.c_str());
+}
+
+unsigned long long CacheAnalise::calculaImpressao(bool direcionado, bool ponderadoVertices, bool ponderadoArestas,
+                                                  const vector<float> &pesosVertices, const VisaoCSR &adjacencia)
+{
+    unsigned long long h = PRIMO1 ^ 0x27D4EB2F165667C5ULL;
+
+    // Cabeçalho
+    h = misturaHash(h, static_cast<unsigned long long>(adjacencia.ordem));
+    h = misturaHash(h, (direcionado ? 1ULL : 0ULL) | (ponderadoVertices ? 2ULL : 0ULL) | (ponderadoArestas ? 4ULL : 0ULL));
+
+    // Pesos dos vértices
+    for (size_t i = 0; i < pesosVertices.size(); i++)
+    {
+        h = misturaHash(h, bitsReal(pesosVertices[i]));
+    }
+
+    // Adjacência ordenada: deslocamentos, vizinhos e pesos das arestas
+    for (size_t i = 0; i < adjacencia.inicio.size(); i++)
+    {
+        h = misturaHash(h, static_cast<unsigned long long>(adjacencia.inicio[i]));
+    }
+    for (size_t i = 0; i < adjacencia.vizinhos.size(); i++)
+    {
+        unsigned long long palavra = static_cast<unsigned int>(adjacencia.vizinhos[i]);
+        if (ponderadoArestas)
+        {
+            palavra |= bitsReal(adjacencia.pesos[i]) << 32;
+        }
+        h = misturaHash(h, palavra);
+    }
+
+    // Avalanche final
+    h ^= h >> 33;
+    h *= PRIMO2;
+    h ^= h >> 29;
+    return h;
+}
+
+string CacheAnalise::impressaoHex(unsigned long long impressao)
+{
+    char texto[17];
+    snprintf(texto, sizeof(texto), "%016llx", impressao);
+    return texto;
+}
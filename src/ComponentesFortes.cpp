@@ -0,0 +1,399 @@
+/**
+ * @file ComponentesFortes.cpp
+ * @brief Implementação das componentes fortemente conexas: Tarjan iterativo, versão paralela e condensação.
+ */
+
+#include "../include/ComponentesFortes.h"
+#include "../include/Grafo.h"
+#include "../include/Paralelo.h"
+#include <algorithm>
+#include <atomic>
+
+using namespace std;
+
+namespace
+{
+    /// Vértices da fronteira por tarefa nas buscas paralelas.
+    const int VERTICES_POR_TAREFA = 1024;
+
+    /// Bits de marca das buscas a partir do pivô.
+    const unsigned char FRENTE = 1;
+    const unsigned char TRAS = 2;
+
+    /**
+     * Busca em largura por níveis a partir de origem, só entre vértices ativos, com a fronteira dividida entre
+     * threads. Cada vértice alcançado recebe bit em marca; quem liga o bit é quem o põe no próximo nível.
+     */
+    void marcaAlcancaveis(const VisaoCSR &adjacencia, int origem, unsigned char bit, const vector<char> &ativo,
+                          vector<atomic<unsigned char>> &marca, int numThreads)
+    {
+        vector<int> fronteira(1, origem);
+        marca[origem].fetch_or(bit, memory_order_relaxed);
+        while (!fronteira.empty())
+        {
+            int tamanho = static_cast<int>(fronteira.size());
+            int numTarefas = (tamanho + VERTICES_POR_TAREFA - 1) / VERTICES_POR_TAREFA;
+            vector<vector<int>> proximos(numTarefas);
+            Paralelo::executa(numTarefas, numThreads, [&](int t)
+            {
+                int fim = min(tamanho, (t + 1) * VERTICES_POR_TAREFA);
+                for (int i = t * VERTICES_POR_TAREFA; i < fim; i++)
+                {
+                    int u = fronteira[i];
+                    for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
+                    {
+                        int w = adjacencia.vizinhos[k];
+                        if (ativo[w] && !(marca[w].load(memory_order_relaxed) & bit) &&
+                            !(marca[w].fetch_or(bit, memory_order_relaxed) & bit))
+                        {
+                            proximos[t].push_back(w);
+                        }
+                    }
+                }
+            });
+            fronteira.clear();
+            for (const vector<int> &proximo : proximos)
+            {
+                fronteira.insert(fronteira.end(), proximo.begin(), proximo.end());
+            }
+        }
+    }
+}
+
+ComponentesFortes::ComponentesFortes() : grafo(nullptr), ordem(0), direcionado(false)
+{
+}
+
+void ComponentesFortes::prepara(Grafo &grafo)
+{
+    this->grafo = &grafo;
+    saida = grafo.visaoCSR();
+    ordem = saida.ordem;
+    direcionado = grafo.ehDirecionado();
+    removido.assign(ordem, 0);
+    for (int v = 0; v < ordem; v++)
+    {
+        removido[v] = grafo.estaRemovido(v);
+    }
+    entrada = VisaoCSR();
+}
+
+const VisaoCSR &ComponentesFortes::transposta()
+{
+    if (!direcionado)
+    {
+        return saida;
+    }
+    if (entrada.inicio.empty())
+    {
+        entrada = grafo->transposta();
+    }
+    return entrada;
+}
+
+int ComponentesFortes::renumera(vector<int> &rotulo) const
+{
+    vector<int> numero(ordem, -1);
+    int numComponentes = 0;
+    for (int v = 0; v < ordem; v++)
+    {
+        if (rotulo[v] == -1)
+        {
+            continue;
+        }
+        if (numero[rotulo[v]] == -1)
+        {
+            numero[rotulo[v]] = numComponentes++;
+        }
+        rotulo[v] = numero[rotulo[v]];
+    }
+    return numComponentes;
+}
+
+int ComponentesFortes::tarjan(vector<int> &rotulo)
+{
+    rotulo.assign(ordem, -1);
+    vector<int> indice(ordem, -1), low(ordem, 0), proximo(ordem, 0);
+    vector<char> naPilha(ordem, 0);
+    vector<int> busca;      // Caminho da busca em profundidade
+    vector<int> componente; // Vértices visitados cuja componente ainda não foi fechada
+    int tempo = 0;
+
+    for (int raiz = 0; raiz < ordem; raiz++)
+    {
+        if (removido[raiz] || indice[raiz] != -1)
+        {
+            continue;
+        }
+        indice[raiz] = low[raiz] = tempo++;
+        proximo[raiz] = saida.inicio[raiz];
+        busca.push_back(raiz);
+        componente.push_back(raiz);
+        naPilha[raiz] = 1;
+
+        while (!busca.empty())
+        {
+            int v = busca.back();
+            if (proximo[v] < saida.inicio[v + 1])
+            {
+                int w = saida.vizinhos[proximo[v]++];
+                if (indice[w] == -1)
+                {
+                    indice[w] = low[w] = tempo++;
+                    proximo[w] = saida.inicio[w];
+                    busca.push_back(w);
+                    componente.push_back(w);
+                    naPilha[w] = 1;
+                }
+                else if (naPilha[w] && indice[w] < low[v])
+                {
+                    low[v] = indice[w];
+                }
+                continue;
+            }
+
+            // v terminou: propaga o lowlink ao pai e, se v for a raiz da sua componente, fecha a componente
+            busca.pop_back();
+            if (!busca.empty() && low[v] < low[busca.back()])
+            {
+                low[busca.back()] = low[v];
+            }
+            if (low[v] == indice[v])
+            {
+                int w;
+                do
+                {
+                    w = componente.back();
+                    componente.pop_back();
+                    naPilha[w] = 0;
+                    rotulo[w] = v;
+                } while (w != v);
+            }
+        }
+    }
+    return renumera(rotulo);
+}
+
+int ComponentesFortes::paralelo(vector<int> &rotulo, int numThreads)
+{
+    numThreads = Paralelo::resolveThreads(numThreads);
+    const VisaoCSR &tras = transposta();
+    rotulo.assign(ordem, -1); // Durante o cálculo, o rótulo é um vértice da componente
+    vector<char> ativo(ordem, 0);
+    vector<int> ativos;
+    for (int v = 0; v < ordem; v++)
+    {
+        if (!removido[v])
+        {
+            ativo[v] = 1;
+            ativos.push_back(v);
+        }
+    }
+
+    // Divide a lista de ativos em faixas, uma por tarefa
+    auto porFaixas = [&](const function<void(int, int)> &faixa)
+    {
+        int tamanho = static_cast<int>(ativos.size());
+        int numTarefas = (tamanho + VERTICES_POR_TAREFA - 1) / VERTICES_POR_TAREFA;
+        Paralelo::executa(numTarefas, numThreads, [&](int t)
+        {
+            faixa(t * VERTICES_POR_TAREFA, min(tamanho, (t + 1) * VERTICES_POR_TAREFA));
+        });
+    };
+
+    // Tira da lista os vértices que já têm componente
+    auto retiraRotulados = [&]()
+    {
+        size_t restantes = 0;
+        for (int v : ativos)
+        {
+            if (rotulo[v] == -1)
+            {
+                ativos[restantes++] = v;
+            }
+            else
+            {
+                ativo[v] = 0;
+            }
+        }
+        ativos.resize(restantes);
+    };
+
+    // Poda: um vértice sem arcos de entrada ou de saída entre os ativos (fora laços) é uma componente sozinho.
+    // A decisão de cada vértice usa os ativos do início da rodada, e os rótulos são gravados só no fim dela
+    vector<char> isolado(ordem, 0);
+    auto poda = [&]()
+    {
+        porFaixas([&](int inicio, int fim)
+        {
+            for (int i = inicio; i < fim; i++)
+            {
+                int v = ativos[i];
+                bool temSaida = false;
+                for (int k = saida.inicio[v]; k < saida.inicio[v + 1] && !temSaida; k++)
+                {
+                    temSaida = saida.vizinhos[k] != v && ativo[saida.vizinhos[k]];
+                }
+                bool temEntrada = false;
+                for (int k = tras.inicio[v]; k < tras.inicio[v + 1] && temSaida && !temEntrada; k++)
+                {
+                    temEntrada = tras.vizinhos[k] != v && ativo[tras.vizinhos[k]];
+                }
+                isolado[v] = !temSaida || !temEntrada;
+            }
+        });
+        for (int v : ativos)
+        {
+            if (isolado[v])
+            {
+                rotulo[v] = v;
+            }
+        }
+        retiraRotulados();
+    };
+
+    poda();
+
+    // Pivô de maior produto de graus: em grafos com componente gigante, quase sempre está nela
+    if (!ativos.empty())
+    {
+        int pivo = ativos[0];
+        long long melhor = -1;
+        for (int v : ativos)
+        {
+            long long produto = static_cast<long long>(saida.grau(v)) * tras.grau(v);
+            if (produto > melhor)
+            {
+                melhor = produto;
+                pivo = v;
+            }
+        }
+        vector<atomic<unsigned char>> marca(ordem);
+        for (int v = 0; v < ordem; v++)
+        {
+            marca[v].store(0, memory_order_relaxed);
+        }
+        marcaAlcancaveis(saida, pivo, FRENTE, ativo, marca, numThreads);
+        marcaAlcancaveis(tras, pivo, TRAS, ativo, marca, numThreads);
+        for (int v : ativos)
+        {
+            if (marca[v].load(memory_order_relaxed) == (FRENTE | TRAS))
+            {
+                rotulo[v] = pivo;
+            }
+        }
+        retiraRotulados();
+    }
+
+    // Coloração: cada vértice fica com o maior índice que o alcança entre os ativos
+    vector<atomic<int>> cor(ordem);
+    while (!ativos.empty())
+    {
+        poda();
+        if (ativos.empty())
+        {
+            break;
+        }
+        for (int v : ativos)
+        {
+            cor[v].store(v, memory_order_relaxed);
+        }
+        atomic<bool> mudou(true);
+        while (mudou.load())
+        {
+            mudou.store(false);
+            porFaixas([&](int inicio, int fim)
+            {
+                bool mudouFaixa = false;
+                for (int i = inicio; i < fim; i++)
+                {
+                    int v = ativos[i];
+                    int corV = cor[v].load(memory_order_relaxed);
+                    for (int k = saida.inicio[v]; k < saida.inicio[v + 1]; k++)
+                    {
+                        int w = saida.vizinhos[k];
+                        if (!ativo[w])
+                        {
+                            continue;
+                        }
+                        int corW = cor[w].load(memory_order_relaxed);
+                        while (corW < corV && !cor[w].compare_exchange_weak(corW, corV, memory_order_relaxed))
+                        {
+                        }
+                        mudouFaixa = mudouFaixa || corW < corV;
+                    }
+                }
+                if (mudouFaixa)
+                {
+                    mudou.store(true);
+                }
+            });
+        }
+
+        // Cada raiz (vértice que manteve a própria cor) busca para trás dentro da sua cor; as cores são disjuntas,
+        // então as buscas das raízes não disputam vértices
+        vector<int> raizes;
+        for (int v : ativos)
+        {
+            if (cor[v].load(memory_order_relaxed) == v)
+            {
+                raizes.push_back(v);
+            }
+        }
+        int numRaizes = static_cast<int>(raizes.size());
+        Paralelo::executa(numRaizes, numThreads, [&](int t)
+        {
+            int raiz = raizes[t];
+            vector<int> pilha(1, raiz);
+            rotulo[raiz] = raiz;
+            while (!pilha.empty())
+            {
+                int u = pilha.back();
+                pilha.pop_back();
+                for (int k = tras.inicio[u]; k < tras.inicio[u + 1]; k++)
+                {
+                    int w = tras.vizinhos[k];
+                    if (ativo[w] && cor[w].load(memory_order_relaxed) == raiz && rotulo[w] == -1)
+                    {
+                        rotulo[w] = raiz;
+                        pilha.push_back(w);
+                    }
+                }
+            }
+        });
+        retiraRotulados();
+    }
+    return renumera(rotulo);
+}
+
+void ComponentesFortes::condensacao(const vector<int> &rotulo, int numComponentes, VisaoCSR &dag) const
+{
+    vector<ArestaLida> arcos;
+    for (int u = 0; u < ordem; u++)
+    {
+        for (int k = saida.inicio[u]; k < saida.inicio[u + 1]; k++)
+        {
+            int w = saida.vizinhos[k];
+            if (rotulo[u] != rotulo[w])
+            {
+                ArestaLida arco = {rotulo[u], rotulo[w], saida.pesos[k]};
+                arcos.push_back(arco);
+            }
+        }
+    }
+
+    // Um arco por par de componentes, com o menor peso
+    sort(arcos.begin(), arcos.end(), [](const ArestaLida &a, const ArestaLida &b)
+    {
+        if (a.origem != b.origem)
+            return a.origem < b.origem;
+        if (a.destino != b.destino)
+            return a.destino < b.destino;
+        return a.peso < b.peso;
+    });
+    arcos.erase(unique(arcos.begin(), arcos.end(), [](const ArestaLida &a, const ArestaLida &b)
+    {
+        return a.origem == b.origem && a.destino == b.destino;
+    }), arcos.end());
+    dag.constroi(numComponentes, arcos, true);
+}
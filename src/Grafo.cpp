@@ -6,15 +6,1004 @@
 #include "../include/Grafo.h"
 #include "../include/No.h"
 #include "../include/Aresta.h"
+#include "../include/CacheAnalise.h"
+#include "../include/ComponentesFortes.h"
+#include "../include/HeapRadix.h"
+#include "../include/Paralelo.h"
 #include <iostream>
-#include <climits>
+#include <new>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <mutex>
+#include <queue>
+#include <vector>
 
 using namespace std;
 
+namespace
+{
+    /// Heap binário sobre distâncias reais (fila padrão do Dijkstra). Mantém a capacidade ao ser esvaziado.
+    class FilaBinaria
+    {
+        vector<pair<double, int>> heap;
+
+    public:
+        void insere(double distancia, int v)
+        {
+            heap.push_back(make_pair(distancia, v));
+            push_heap(heap.begin(), heap.end(), greater<pair<double, int>>());
+        }
+        bool vazia() const { return heap.empty(); }
+        void removeMinimo(double &distancia, int &v)
+        {
+            pop_heap(heap.begin(), heap.end(), greater<pair<double, int>>());
+            distancia = heap.back().first;
+            v = heap.back().second;
+            heap.pop_back();
+        }
+        void limpa() { heap.clear(); }
+    };
+
+    /// HeapRadix sobre distâncias inteiras (exatas em double até 2^53).
+    class FilaRadix
+    {
+        HeapRadix heap;
+
+    public:
+        void insere(double distancia, int v) { heap.insere(static_cast<unsigned long long>(distancia), v); }
+        bool vazia() const { return heap.vazio(); }
+        void removeMinimo(double &distancia, int &v)
+        {
+            unsigned long long chave;
+            heap.removeMinimo(chave, v);
+            distancia = static_cast<double>(chave);
+        }
+        void limpa() { heap.limpa(); }
+    };
+
+    /// Número mínimo de entradas de adjacência para o Bellman-Ford usar rodadas paralelas.
+    const int MIN_ENTRADAS_PARALELO = 1 << 16;
+
+    /// Tamanho mínimo da fronteira para o delta-stepping dividir as relaxações entre threads.
+    const int MIN_FRONTEIRA_PARALELA = 1024;
+
+    /// Número máximo de baldes do delta-stepping (os baldes são reutilizados circularmente).
+    const long long MAX_BALDES = 1 << 16;
+
+    const char ASSINATURA_LOTE[8] = {'G', 'R', 'L', 'O', 'T', 'E', '0', '1'};
+    const size_t TAMANHO_CABECALHO_LOTE = 64; // Mesmo tamanho do cabeçalho de MatrizDistancias
+
+    /// Cabeçalho do arquivo de distanciasLote, completado com zeros até TAMANHO_CABECALHO_LOTE.
+    struct CabecalhoLote
+    {
+        char assinatura[8];
+        int32_t numOrigens;
+        int32_t ordem;
+    };
+
+    /// Arestas de cada vértice unidas antes da amostragem em componentesConexas.
+    const int RODADAS_VIZINHOS = 2;
+
+    /// Vértices amostrados para identificar a maior componente em componentesConexas.
+    const int NUM_AMOSTRAS = 1024;
+
+    /**
+     * Une as árvores de u e v: o representante de maior índice passa a apontar para o de menor, por compare-and-swap.
+     * Se outra thread mudar o representante antes, a união recomeça pelos novos representantes.
+     */
+    void ligaComponentes(vector<atomic<int>> &pai, int u, int v)
+    {
+        int a = pai[u].load(memory_order_relaxed);
+        int b = pai[v].load(memory_order_relaxed);
+        while (a != b)
+        {
+            int maior = max(a, b);
+            int menor = min(a, b);
+            int paiMaior = pai[maior].load(memory_order_relaxed);
+            if (paiMaior == menor)
+            {
+                return;
+            }
+            if (paiMaior == maior && pai[maior].compare_exchange_strong(paiMaior, menor, memory_order_relaxed))
+            {
+                return;
+            }
+            a = pai[pai[maior].load(memory_order_relaxed)].load(memory_order_relaxed);
+            b = pai[menor].load(memory_order_relaxed);
+        }
+    }
+
+    /// Faz cada vértice de [inicio, fim) apontar direto para o representante da sua árvore.
+    void comprimeComponentes(vector<atomic<int>> &pai, int inicio, int fim)
+    {
+        for (int v = inicio; v < fim; v++)
+        {
+            int p = pai[v].load(memory_order_relaxed);
+            while (p != pai[p].load(memory_order_relaxed))
+            {
+                p = pai[p].load(memory_order_relaxed);
+            }
+            pai[v].store(p, memory_order_relaxed);
+        }
+    }
+
+    /// Acrescenta a caminho os vértices de origem até v, seguindo anterior (no máximo limite vértices).
+    void montaCaminho(const vector<int> &anterior, int v, int limite, vector<int> &caminho)
+    {
+        size_t inicio = caminho.size();
+        for (; v != -1 && static_cast<int>(caminho.size() - inicio) <= limite; v = anterior[v])
+        {
+            caminho.push_back(v);
+        }
+        reverse(caminho.begin() + inicio, caminho.end());
+    }
+
+    /**
+     * Verifica se os predecessores do Bellman-Ford formam um ciclo. Como cada predecessor é gravado numa
+     * melhora estrita, um ciclo entre eles só existe se houver ciclo de custo negativo; a verificação
+     * periódica evita esperar as V rodadas (O(VE)) para detectá-lo. Custa O(V).
+     */
+    bool predecessoresComCiclo(const vector<int> &anterior)
+    {
+        int n = static_cast<int>(anterior.size());
+        vector<int> visita(n, -1); // Vértice de partida da caminhada que passou por cada vértice
+        for (int inicio = 0; inicio < n; inicio++)
+        {
+            int v = inicio;
+            while (v != -1 && visita[v] == -1)
+            {
+                visita[v] = inicio;
+                v = anterior[v];
+            }
+            if (v != -1 && visita[v] == inicio)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * Dijkstra com inserção preguiçosa: um vértice pode estar na fila várias vezes, e as entradas com
+     * distância maior que a atual são descartadas ao sair. Para ao fechar o destino.
+     * O custo de uma aresta (u, v) é o peso dela mais o de v e, com potenciais, mais h(u) - h(v).
+     * Devolve a distância a partir de 0 na origem (infinito se inalcançável ou se destino for -1, caso em que
+     * todos os vértices alcançáveis são fechados); preenche distancia, anterior (predecessor de cada vértice no
+     * caminho) e o número de vértices fechados.
+     */
+    template <typename Fila>
+    double buscaDijkstra(const vector<No *> &nos, const vector<float> &pesosNos, const vector<double> *potencial,
+                         int origem, int destino, vector<double> &distancia, vector<int> &anterior, int &visitados)
+    {
+        const double infinito = numeric_limits<double>::infinity();
+        int n = static_cast<int>(nos.size());
+        distancia.assign(n, infinito);
+        anterior.assign(n, -1);
+        visitados = 0;
+
+        Fila fila;
+        distancia[origem] = 0;
+        fila.insere(0, origem);
+        while (!fila.vazia())
+        {
+            double d;
+            int u;
+            fila.removeMinimo(d, u);
+            if (d > distancia[u])
+            {
+                continue; // Entrada antiga: u já saiu com distância menor
+            }
+            visitados++;
+            if (u == destino)
+            {
+                return d;
+            }
+            double ajuste = potencial != nullptr ? (*potencial)[u] : 0;
+            for (Aresta *aresta = nos[u]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+            {
+                int v = aresta->getIdDestino();
+                double custo = aresta->getPeso() + pesosNos[v];
+                if (potencial != nullptr)
+                {
+                    custo += ajuste - (*potencial)[v];
+                }
+                double candidata = d + custo;
+                if (candidata < distancia[v])
+                {
+                    distancia[v] = candidata;
+                    anterior[v] = u;
+                    fila.insere(candidata, v);
+                }
+            }
+        }
+        return infinito;
+    }
+
+    /**
+     * Dijkstra a partir de cada origem do lote sobre a adjacência CSR, com o custo de cada entrada já calculado
+     * (peso da aresta mais o do vértice de chegada e, com potenciais, mais h(u) - h(v)). Cada thread pega a
+     * próxima origem de um contador compartilhado e reaproveita a sua fila e o seu vetor de distâncias de uma
+     * busca para a outra; as linhas prontas, já com o peso da origem e o custo original, são entregues ao
+     * consumidor uma de cada vez. Devolve o total de vértices fechados.
+     */
+    template <typename Fila>
+    int loteDijkstra(const VisaoCSR &adjacencia, const vector<double> &custo, const vector<float> &pesosNos,
+                     const vector<double> *potencial, const vector<int> &origens, int numThreads,
+                     const Grafo::ConsumidorDistancias &consumidor)
+    {
+        const double infinito = numeric_limits<double>::infinity();
+        int numOrigens = static_cast<int>(origens.size());
+        int n = adjacencia.ordem;
+        atomic<int> proxima(0);
+        mutex entrega;
+        int totalVisitados = 0;
+        Paralelo::executa(numThreads, numThreads, [&](int)
+        {
+            Fila fila;
+            vector<double> distancia;
+            int visitados = 0;
+            for (int i = proxima++; i < numOrigens; i = proxima++)
+            {
+                int origem = origens[i];
+                distancia.assign(n, infinito);
+                fila.limpa();
+                distancia[origem] = 0;
+                fila.insere(0, origem);
+                while (!fila.vazia())
+                {
+                    double d;
+                    int u;
+                    fila.removeMinimo(d, u);
+                    if (d > distancia[u])
+                    {
+                        continue;
+                    }
+                    visitados++;
+                    for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
+                    {
+                        int v = adjacencia.vizinhos[k];
+                        double candidata = d + custo[k];
+                        if (candidata < distancia[v])
+                        {
+                            distancia[v] = candidata;
+                            fila.insere(candidata, v);
+                        }
+                    }
+                }
+                for (int v = 0; v < n; v++)
+                {
+                    if (distancia[v] != infinito)
+                    {
+                        distancia[v] += pesosNos[origem];
+                        if (potencial != nullptr)
+                        {
+                            distancia[v] += (*potencial)[v] - (*potencial)[origem];
+                        }
+                    }
+                }
+                lock_guard<mutex> trava(entrega);
+                consumidor(i, origem, distancia);
+            }
+            lock_guard<mutex> trava(entrega);
+            totalVisitados += visitados;
+        });
+        return totalVisitados;
+    }
+}
+
 Grafo::Grafo(int ordem, bool direcionado, bool ponderadoVertices, bool ponderadoArestas)
-    : ordem(ordem), direcionado(direcionado), ponderadoVertices(ponderadoVertices), ponderadoArestas(ponderadoArestas) {}
+    : ordem(ordem), numNos(0), direcionado(direcionado), ponderadoVertices(ponderadoVertices), ponderadoArestas(ponderadoArestas),
+      arenaNos(sizeof(No)), arenaArestas(sizeof(Aresta)), primeiroNo(nullptr), ultimoNo(nullptr), numRemovidos(0), impressaoDigital(0), impressaoValida(false),
+      versao(1), numArestas(0), numLacos(0), versaoPerfil(0), versaoTransposta(0), pesosInteirosCache(false), pesosNegativosCache(false), versaoPesos(0),
+      cicloNegativo(false), versaoPotenciais(0), verticesVisitados(0) {}
+
+Grafo::~Grafo()
+{
+    liberaNos();
+}
+
+void Grafo::carregaGrafo(const std::string &arquivo)
+{
+    DadosGrafo dados;
+    if (!Importador::carrega(arquivo, dados))
+    {
+        return;
+    }
+    constroiGrafo(dados);
+    cout << "Grafo carregado com sucesso: " << ordem << " vértices, " << dados.arestas.size() << " arestas." << endl;
+}
+
+void Grafo::novoGrafo(const std::string &arquivoConfig)
+{
+    DadosGrafo dados;
+    if (!Importador::carrega(arquivoConfig, dados))
+    {
+        return;
+    }
+    constroiGrafo(dados);
+    cout << "Novo grafo configurado como " << dados.estrutura << "." << endl;
+}
+
+void Grafo::constroiGrafo(const DadosGrafo &dados)
+{
+    liberaNos();
+
+    this->ordem = dados.ordem;
+    this->direcionado = dados.direcionado;
+    this->ponderadoVertices = dados.ponderadoVertices;
+    this->ponderadoArestas = dados.ponderadoArestas;
+    ids = dados.ids;
+    if (ids.tamanho() != ordem)
+    {
+        ids.configuraIdentidade(ordem, 1); // Formatos com IDs 1..n
+    }
+
+    // Ordena e agrupa as arestas por vértice uma única vez; todos os backends partem daqui
+    VisaoCSR adjacencia;
+    adjacencia.constroi(ordem, dados.arestas, direcionado);
+
+    impressaoDigital = CacheAnalise::calculaImpressao(direcionado, ponderadoVertices, ponderadoArestas,
+                                                      dados.pesosVertices, adjacencia);
+    impressaoValida = true;
+    versao++;
+
+    // Contadores de arestas e graus, mantidos a partir daqui pelas operações de alteração
+    recontaArestas(adjacencia);
+    removidos.assign(ordem, 0);
+    numRemovidos = 0;
+
+    constroiNos(adjacencia, dados.pesosVertices);
+    constroiEstrutura(adjacencia);
+}
+
+VisaoCSR Grafo::visaoCSR()
+{
+    vector<ArestaLida> arestas;
+    No *no = primeiroNo;
+    while (no != nullptr)
+    {
+        Aresta *aresta = no->getPrimeiraAresta();
+        while (aresta != nullptr)
+        {
+            ArestaLida lida = {no->getIdNo(), aresta->getIdDestino(), aresta->getPeso()};
+            arestas.push_back(lida);
+            aresta = aresta->getProxAresta();
+        }
+        no = no->getProxNo();
+    }
+    VisaoCSR visao;
+    visao.constroi(ordem, arestas, true); // as listas de arestas já guardam os dois sentidos
+    return visao;
+}
+
+PerfilGrafo Grafo::calculaPerfil()
+{
+    PerfilGrafo perfil;
+    VisaoCSR adjacencia = visaoCSR();
+    int n = adjacencia.ordem;
+    int vivos = n - numRemovidos; // Vértices removidos ocupam índices, mas não têm arestas e são ignorados
+    perfil.ordem = vivos;
+    if (vivos == 0)
+    {
+        perfil.completo = true;
+        return perfil;
+    }
+
+    // Graus, arestas e completude a partir da adjacência de saída
+    int lacos = 0;
+    bool completo = true;
+    perfil.grauMinimo = -1;
+    for (int v = 0; v < n; v++)
+    {
+        if (estaRemovido(v))
+        {
+            continue;
+        }
+        int grau = adjacencia.grau(v);
+        int lacosV = 0;
+        for (int k = adjacencia.inicio[v]; k < adjacencia.inicio[v + 1]; k++)
+        {
+            if (adjacencia.vizinhos[k] == v)
+            {
+                lacosV++;
+            }
+        }
+        lacos += lacosV;
+        completo = completo && (grau - lacosV == vivos - 1);
+        if (perfil.grauMinimo == -1 || grau < perfil.grauMinimo)
+            perfil.grauMinimo = grau;
+        if (grau > perfil.grauMaximo)
+            perfil.grauMaximo = grau;
+    }
+    perfil.numArestas = direcionado ? adjacencia.numEntradas() : (adjacencia.numEntradas() + lacos) / 2;
+    perfil.grauMedio = static_cast<double>(adjacencia.numEntradas()) / vivos;
+    perfil.completo = completo;
+
+    // Busca em profundidade iterativa sobre o grafo subjacente não direcionado
+    VisaoCSR simetrica;
+    const VisaoCSR *g = &adjacencia;
+    if (direcionado)
+    {
+        simetrica = adjacencia.simetrica();
+        g = &simetrica;
+    }
+
+    vector<int> descoberta(n, -1), low(n, 0), pai(n, -1), proximo(n, 0), pilha;
+    vector<char> cor(n, 0), articulacao(n, 0);
+    pilha.reserve(n);
+    int tempo = 0;
+    int lacosSimetricos = 0;
+
+    for (int raiz = 0; raiz < n; raiz++)
+    {
+        if (descoberta[raiz] != -1 || estaRemovido(raiz))
+        {
+            continue;
+        }
+        perfil.componentes++;
+        bool bipartida = true;
+        int filhosRaiz = 0;
+
+        descoberta[raiz] = low[raiz] = tempo++;
+        proximo[raiz] = g->inicio[raiz];
+        pilha.push_back(raiz);
+
+        while (!pilha.empty())
+        {
+            int v = pilha.back();
+            if (proximo[v] < g->inicio[v + 1])
+            {
+                int w = g->vizinhos[proximo[v]++];
+                if (w == v)
+                {
+                    lacosSimetricos++;
+                    bipartida = false; // um laço impede a 2-coloração
+                }
+                else if (descoberta[w] == -1)
+                {
+                    pai[w] = v;
+                    cor[w] = 1 - cor[v];
+                    descoberta[w] = low[w] = tempo++;
+                    proximo[w] = g->inicio[w];
+                    pilha.push_back(w);
+                    if (v == raiz)
+                    {
+                        filhosRaiz++;
+                    }
+                }
+                else if (w != pai[v])
+                {
+                    if (descoberta[w] < low[v])
+                    {
+                        low[v] = descoberta[w];
+                    }
+                    if (cor[w] == cor[v])
+                    {
+                        bipartida = false;
+                    }
+                }
+            }
+            else
+            {
+                // v terminou: propaga o lowlink ao pai e testa ponte/articulação
+                pilha.pop_back();
+                int p = pai[v];
+                if (p != -1)
+                {
+                    if (low[v] < low[p])
+                    {
+                        low[p] = low[v];
+                    }
+                    if (low[v] > descoberta[p])
+                    {
+                        perfil.numPontes++;
+                    }
+                    if (p != raiz && low[v] >= descoberta[p])
+                    {
+                        articulacao[p] = 1;
+                    }
+                }
+            }
+        }
+
+        if (filhosRaiz > 1)
+        {
+            articulacao[raiz] = 1;
+        }
+        if (bipartida)
+        {
+            perfil.componentesBipartidas++;
+        }
+    }
+
+    for (int v = 0; v < n; v++)
+    {
+        perfil.numArticulacoes += articulacao[v];
+    }
+
+    // Árvore: conexo, sem laços e com exatamente n - 1 arestas (nos direcionados, arcos opostos contam duas vezes)
+    perfil.arvore = perfil.componentes == 1 && lacosSimetricos == 0 && perfil.numArestas == vivos - 1;
+
+    perfil.componentesFortes = perfil.componentes;
+    if (direcionado)
+    {
+        ComponentesFortes fortes;
+        fortes.prepara(*this);
+        vector<int> rotulo;
+        perfil.componentesFortes = fortes.tarjan(rotulo);
+    }
+    return perfil;
+}
+
+void Grafo::registraAlteracao()
+{
+    impressaoValida = false;
+    versao++;
+}
+
+void Grafo::contaAresta(int origem, int destino, int delta)
+{
+    numArestas += delta;
+    if (origem == destino)
+    {
+        numLacos += delta;
+    }
+    grausSaida[origem] += delta;
+    grausEntrada[destino] += delta;
+    if (!direcionado && origem != destino)
+    {
+        grausSaida[destino] += delta;
+        grausEntrada[origem] += delta;
+    }
+}
+
+void Grafo::recontaArestas(const VisaoCSR &adjacencia)
+{
+    grausSaida.assign(ordem, 0);
+    grausEntrada.assign(ordem, 0);
+    numLacos = 0;
+    for (int v = 0; v < adjacencia.ordem; v++)
+    {
+        grausSaida[v] = adjacencia.grau(v);
+        for (int k = adjacencia.inicio[v]; k < adjacencia.inicio[v + 1]; k++)
+        {
+            grausEntrada[adjacencia.vizinhos[k]]++;
+            if (adjacencia.vizinhos[k] == v)
+            {
+                numLacos++;
+            }
+        }
+    }
+    numArestas = direcionado ? adjacencia.numEntradas() : (adjacencia.numEntradas() + numLacos) / 2;
+}
+
+const PerfilGrafo &Grafo::getPerfil()
+{
+    if (versaoPerfil != versao)
+    {
+        perfilCache = calculaPerfil();
+        versaoPerfil = versao;
+    }
+    return perfilCache;
+}
+
+const VisaoCSR &Grafo::transposta()
+{
+    if (versaoTransposta != versao)
+    {
+        transpostaCache = direcionado ? Grafo::visaoCSR().transposta() : Grafo::visaoCSR();
+        versaoTransposta = versao;
+    }
+    return transpostaCache;
+}
+
+long long Grafo::getIdExterno(int indice)
+{
+    return ids.externo(indice);
+}
+
+int Grafo::getIndice(long long idExterno)
+{
+    int indice = ids.indice(idExterno);
+    return (indice != -1 && removidos[indice]) ? -1 : indice;
+}
+
+int Grafo::getNumArestas()
+{
+    return numArestas;
+}
+
+unsigned long Grafo::getVersao()
+{
+    return versao;
+}
+
+bool Grafo::getImpressaoDigital(unsigned long long &impressao)
+{
+    impressao = impressaoDigital;
+    return impressaoValida;
+}
+
+void Grafo::constroiNos(const VisaoCSR &adjacencia, const std::vector<float> &pesosVertices)
+{
+    nos.assign(ordem, nullptr);
+    pesosNos.assign(ordem, 0.0f);
+    for (int i = 0; i < ordem; i++)
+    {
+        float peso = pesosVertices.empty() ? 0.0f : pesosVertices[i];
+        pesosNos[i] = peso;
+        nos[i] = new (arenaNos.aloca()) No(i, peso, &arenaArestas);
+        if (i > 0)
+        {
+            nos[i - 1]->setProxNo(nos[i]);
+        }
+    }
+    primeiroNo = ordem > 0 ? nos[0] : nullptr;
+    ultimoNo = ordem > 0 ? nos[ordem - 1] : nullptr;
+    numNos = ordem;
+
+    predecessores.assign(direcionado ? ordem : 0, vector<int>());
+    for (int v = 0; v < ordem; v++)
+    {
+        for (int k = adjacencia.inicio[v]; k < adjacencia.inicio[v + 1]; k++)
+        {
+            No *destino = nos[adjacencia.vizinhos[k]];
+            nos[v]->adicionaAresta(destino, adjacencia.pesos[k], direcionado);
+            if (direcionado)
+            {
+                destino->incGrauEntrada();
+                predecessores[adjacencia.vizinhos[k]].push_back(v);
+            }
+        }
+    }
+}
+
+No *Grafo::anexaNo(float peso)
+{
+    No *novo = new (arenaNos.aloca()) No(static_cast<int>(nos.size()), peso, &arenaArestas);
+    if (ultimoNo != nullptr)
+    {
+        ultimoNo->setProxNo(novo);
+    }
+    else
+    {
+        primeiroNo = novo;
+    }
+    ultimoNo = novo;
+    nos.push_back(novo);
+    pesosNos.push_back(peso);
+    grausSaida.push_back(0);
+    grausEntrada.push_back(0);
+    removidos.push_back(0);
+    if (direcionado)
+    {
+        predecessores.push_back(vector<int>());
+    }
+    ids.insere(ids.proximoLivre());
+    numNos++;
+    return novo;
+}
+
+void Grafo::marcaRemovido(int id, vector<int> &saida, vector<int> &entrada)
+{
+    saida.clear();
+    entrada.clear();
+    for (Aresta *aresta = nos[id]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+    {
+        saida.push_back(aresta->getIdDestino());
+    }
+    if (direcionado)
+    {
+        entrada = predecessores[id];
+    }
+
+    // Só as arestas incidentes são visitadas: O(grau) em vez de percorrer o grafo inteiro
+    for (size_t k = 0; k < saida.size(); k++)
+    {
+        desligaNos(id, saida[k]);
+    }
+    for (size_t k = 0; k < entrada.size(); k++)
+    {
+        if (entrada[k] != id)
+        {
+            desligaNos(entrada[k], id);
+        }
+    }
+
+    removidos[id] = 1;
+    numRemovidos++;
+}
+
+void Grafo::compactaSeNecessario()
+{
+    // Compacta quando um quarto dos índices é de vértices removidos: o custo linear da
+    // compactação fica amortizado entre as remoções que a provocaram
+    if (numRemovidos > 0 && numRemovidos * 4 >= ordem)
+    {
+        compacta();
+    }
+}
+
+void Grafo::compacta()
+{
+    if (numRemovidos == 0)
+    {
+        return;
+    }
+
+    vector<int> novoIndice(ordem, -1);
+    int novaOrdem = 0;
+    for (int i = 0; i < ordem; i++)
+    {
+        if (!removidos[i])
+        {
+            novoIndice[i] = novaOrdem++;
+        }
+    }
+
+    compactaEstrutura(novoIndice, novaOrdem);
+
+    // Lista de nós: libera os removidos (já sem arestas) e renumera os demais; as arestas
+    // referenciam os nós, então seus IDs de destino acompanham a renumeração
+    No *anterior = nullptr;
+    No *no = primeiroNo;
+    while (no != nullptr)
+    {
+        No *prox = no->getProxNo();
+        int antigo = no->getIdNo();
+        if (removidos[antigo])
+        {
+            if (anterior != nullptr)
+            {
+                anterior->setProxNo(prox);
+            }
+            else
+            {
+                primeiroNo = prox;
+            }
+            no->~No();
+            arenaNos.libera(no);
+        }
+        else
+        {
+            no->setIDNo(novoIndice[antigo]);
+            nos[novoIndice[antigo]] = no;
+            pesosNos[novoIndice[antigo]] = pesosNos[antigo];
+            grausSaida[novoIndice[antigo]] = grausSaida[antigo];
+            grausEntrada[novoIndice[antigo]] = grausEntrada[antigo];
+            if (direcionado)
+            {
+                vector<int> &lista = predecessores[antigo];
+                for (size_t k = 0; k < lista.size(); k++)
+                {
+                    lista[k] = novoIndice[lista[k]];
+                }
+                predecessores[novoIndice[antigo]].swap(lista);
+            }
+            anterior = no;
+        }
+        no = prox;
+    }
+    ultimoNo = anterior;
+
+    nos.resize(novaOrdem);
+    pesosNos.resize(novaOrdem);
+    grausSaida.resize(novaOrdem);
+    grausEntrada.resize(novaOrdem);
+    if (direcionado)
+    {
+        predecessores.resize(novaOrdem);
+    }
+    ids.compacta(novoIndice, novaOrdem);
+    removidos.assign(novaOrdem, 0);
+    numRemovidos = 0;
+    numNos = novaOrdem;
+    ordem = novaOrdem;
+    versao++;
+}
+
+bool Grafo::estaRemovido(int indice)
+{
+    return removidos[indice] != 0;
+}
+
+int Grafo::getNumIndices()
+{
+    return ordem;
+}
+
+bool Grafo::preparaLote(const ArestaLida *arestas, int quantidade, VisaoCSR &lote)
+{
+    // Validação única: nenhuma aresta é aplicada se alguma for inválida
+    for (int k = 0; k < quantidade; k++)
+    {
+        int origem = arestas[k].origem;
+        int destino = arestas[k].destino;
+        if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem || estaRemovido(origem) || estaRemovido(destino))
+        {
+            cout << "Erro: aresta " << k << " do lote liga vértices inválidos (" << origem << ", " << destino << ")." << endl;
+            return false;
+        }
+    }
+
+    // Ordenação por contagem: cada origem forma um bloco contíguo, sem repetições
+    lote.constroi(ordem, vector<ArestaLida>(arestas, arestas + quantidade), direcionado);
+    return true;
+}
+
+void Grafo::adicionaArestas(const ArestaLida *arestas, int quantidade)
+{
+    VisaoCSR lote;
+    if (quantidade <= 0 || !preparaLote(arestas, quantidade, lote))
+    {
+        return;
+    }
+    registraAlteracao();
+
+    // Lista de nós: cada bloco marca os vizinhos atuais da origem uma única vez para saber quais
+    // arestas já existem (essas só têm o peso substituído)
+    vector<char> vizinho(ordem, 0);
+    for (int v = 0; v < ordem; v++)
+    {
+        if (lote.grau(v) == 0)
+        {
+            continue;
+        }
+        for (Aresta *aresta = nos[v]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+        {
+            vizinho[aresta->getIdDestino()] = 1;
+        }
+        for (int k = lote.inicio[v]; k < lote.inicio[v + 1]; k++)
+        {
+            int w = lote.vizinhos[k];
+            if (!direcionado && w < v)
+            {
+                continue; // o sentido w -> v já foi tratado no bloco de w
+            }
+            if (vizinho[w])
+            {
+                desligaNos(v, w);
+            }
+            ligaNos(v, w, lote.pesos[k]);
+        }
+        for (Aresta *aresta = nos[v]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+        {
+            vizinho[aresta->getIdDestino()] = 0;
+        }
+    }
+
+    aplicaLote(lote, false);
+}
+
+void Grafo::removeArestas(const ArestaLida *arestas, int quantidade)
+{
+    VisaoCSR lote;
+    if (quantidade <= 0 || !preparaLote(arestas, quantidade, lote))
+    {
+        return;
+    }
+    registraAlteracao();
+
+    vector<char> vizinho(ordem, 0);
+    for (int v = 0; v < ordem; v++)
+    {
+        if (lote.grau(v) == 0)
+        {
+            continue;
+        }
+        for (Aresta *aresta = nos[v]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+        {
+            vizinho[aresta->getIdDestino()] = 1;
+        }
+        for (int k = lote.inicio[v]; k < lote.inicio[v + 1]; k++)
+        {
+            int w = lote.vizinhos[k];
+            if ((direcionado || w >= v) && vizinho[w])
+            {
+                desligaNos(v, w);
+            }
+        }
+        // Limpa também as marcas das arestas que acabaram de ser removidas
+        for (int k = lote.inicio[v]; k < lote.inicio[v + 1]; k++)
+        {
+            vizinho[lote.vizinhos[k]] = 0;
+        }
+        for (Aresta *aresta = nos[v]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+        {
+            vizinho[aresta->getIdDestino()] = 0;
+        }
+    }
+
+    aplicaLote(lote, true);
+}
+
+int Grafo::adicionaNos(int quantidade)
+{
+    if (quantidade <= 0)
+    {
+        cout << "Erro: quantidade de nós inválida." << endl;
+        return -1;
+    }
+    registraAlteracao();
+
+    // A estrutura do backend cresce uma única vez; depois os nós são só encadeados
+    int primeiro = ordem;
+    reservaNos(ordem + quantidade);
+    nos.reserve(ordem + quantidade);
+    pesosNos.reserve(ordem + quantidade);
+    grausSaida.reserve(ordem + quantidade);
+    grausEntrada.reserve(ordem + quantidade);
+    removidos.reserve(ordem + quantidade);
+    ids.reserva(ordem + quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        ordem++;
+        anexaNo(0);
+    }
+    return primeiro;
+}
+
+void Grafo::ligaNos(int origem, int destino, float peso)
+{
+    nos[origem]->adicionaAresta(nos[destino], peso, direcionado);
+    if (direcionado)
+    {
+        nos[destino]->incGrauEntrada();
+        predecessores[destino].push_back(origem);
+    }
+    else if (origem != destino)
+    {
+        nos[destino]->adicionaAresta(nos[origem], peso, direcionado);
+    }
+    contaAresta(origem, destino, 1);
+}
+
+void Grafo::desligaNos(int origem, int destino)
+{
+    nos[origem]->removeAresta(destino, direcionado);
+    if (direcionado)
+    {
+        vector<int> &lista = predecessores[destino];
+        for (size_t k = 0; k < lista.size(); k++)
+        {
+            if (lista[k] == origem)
+            {
+                lista[k] = lista.back();
+                lista.pop_back();
+                break;
+            }
+        }
+    }
+    else if (origem != destino)
+    {
+        nos[destino]->removeAresta(origem, direcionado);
+    }
+    contaAresta(origem, destino, -1);
+}
 
-Grafo::~Grafo() {}
+void Grafo::liberaNos()
+{
+    // Nós e arestas só guardam memória das arenas: os blocos são devolvidos de uma vez,
+    // sem percorrer a lista de nós
+    arenaArestas.liberaTudo();
+    arenaNos.liberaTudo();
+    primeiroNo = nullptr;
+    ultimoNo = nullptr;
+    nos.clear();
+    pesosNos.clear();
+    predecessores.clear();
+    removidos.clear();
+    numRemovidos = 0;
+    numNos = 0;
+}
 
 int* Grafo::construcaoGulosa(int* tamanhoCobertura) {
     return nullptr; // Implementação vazia para evitar erro de vtable
@@ -26,7 +1015,7 @@ void Grafo::deleta_no(int idNo) {
 
 int Grafo::getOrdem()
 {
-    return ordem;
+    return ordem - numRemovidos;
 }
 
 int Grafo::getNumNos()
@@ -38,410 +1027,1025 @@ bool Grafo::ehDirecionado()
 {
     if (direcionado == 1)
     {
-        return true;
+        return true;
+    }
+    return false;
+}
+
+bool Grafo::verticePonderado()
+{
+    for (int v = 0; v < ordem; v++)
+    {
+        if (pesosNos[v] != 0 && !estaRemovido(v))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool Grafo::arestaPonderada()
+{
+    return ponderadoArestas;
+}
+
+No *Grafo::getNoPeloId(int id)
+{
+    if (id < 0 || id >= static_cast<int>(nos.size()))
+    {
+        return nullptr;
+    }
+    return nos[id];
+}
+
+int Grafo::getGrau(int vertice)
+{
+    if (vertice < 0 || vertice >= static_cast<int>(grausSaida.size()))
+    {
+        std::cout << "Vértice não encontrado";
+        return -1;
+    }
+    return static_cast<int>(grausSaida[vertice]);
+}
+
+int Grafo::getGrauEntrada(int vertice)
+{
+    if (vertice < 0 || vertice >= static_cast<int>(grausEntrada.size()))
+    {
+        std::cout << "Vértice não encontrado";
+        return -1;
+    }
+    return static_cast<int>(grausEntrada[vertice]);
+}
+void Grafo::novaAresta(int origem, int destino, float peso){    }
+
+bool Grafo::ehBipartido()
+{
+    return getPerfil().bipartido();
+}
+
+int Grafo::nConexo()
+{
+    return getPerfil().componentes;
+}
+
+int Grafo::componentesConexas(vector<int> &rotulo, vector<int> *tamanhos, int numThreads)
+{
+    VisaoCSR adjacencia = Grafo::visaoCSR();
+    if (direcionado)
+    {
+        adjacencia = adjacencia.simetrica(); // Componentes fracas: os arcos valem nos dois sentidos
+    }
+    int n = adjacencia.ordem;
+    numThreads = Paralelo::resolveThreads(numThreads);
+    if (adjacencia.numEntradas() < MIN_ENTRADAS_PARALELO)
+    {
+        numThreads = 1;
+    }
+    int numTarefas = numThreads == 1 ? 1 : numThreads * 4;
+    int porTarefa = (n + numTarefas - 1) / numTarefas;
+
+    vector<atomic<int>> pai(n);
+    for (int v = 0; v < n; v++)
+    {
+        pai[v].store(v, memory_order_relaxed);
+    }
+
+    // Rodadas iniciais: só as primeiras arestas de cada vértice, seguidas de compressão
+    for (int rodada = 0; rodada < RODADAS_VIZINHOS; rodada++)
+    {
+        Paralelo::executa(numTarefas, numThreads, [&](int t)
+        {
+            int fim = min(n, (t + 1) * porTarefa);
+            for (int v = t * porTarefa; v < fim; v++)
+            {
+                if (rodada < adjacencia.grau(v))
+                {
+                    ligaComponentes(pai, v, adjacencia.vizinhos[adjacencia.inicio[v] + rodada]);
+                }
+            }
+        });
+        Paralelo::executa(numTarefas, numThreads, [&](int t)
+        {
+            comprimeComponentes(pai, t * porTarefa, min(n, (t + 1) * porTarefa));
+        });
+    }
+
+    // Maior componente parcial, por amostragem em posições fixas (o resultado não depende da execução)
+    int maior = -1;
+    if (n > 0)
+    {
+        vector<int> amostra;
+        for (int i = 0; i < NUM_AMOSTRAS; i++)
+        {
+            int v = static_cast<int>(static_cast<long long>(i) * n / NUM_AMOSTRAS);
+            if (!estaRemovido(v))
+            {
+                amostra.push_back(pai[v].load(memory_order_relaxed));
+            }
+        }
+        sort(amostra.begin(), amostra.end());
+        int melhor = 0;
+        for (size_t i = 0; i < amostra.size();)
+        {
+            size_t j = i;
+            while (j < amostra.size() && amostra[j] == amostra[i])
+            {
+                j++;
+            }
+            if (static_cast<int>(j - i) > melhor)
+            {
+                melhor = static_cast<int>(j - i);
+                maior = amostra[i];
+            }
+            i = j;
+        }
+    }
+
+    // Passada final: as arestas restantes, exceto as de vértices que já estão na maior componente. Como a
+    // adjacência é simétrica, uma aresta pulada por um lado é unida pelo outro, se este estiver fora dela
+    Paralelo::executa(numTarefas, numThreads, [&](int t)
+    {
+        int fim = min(n, (t + 1) * porTarefa);
+        for (int v = t * porTarefa; v < fim; v++)
+        {
+            if (pai[v].load(memory_order_relaxed) == maior)
+            {
+                continue;
+            }
+            for (int k = adjacencia.inicio[v] + RODADAS_VIZINHOS; k < adjacencia.inicio[v + 1]; k++)
+            {
+                ligaComponentes(pai, v, adjacencia.vizinhos[k]);
+            }
+        }
+    });
+    Paralelo::executa(numTarefas, numThreads, [&](int t)
+    {
+        comprimeComponentes(pai, t * porTarefa, min(n, (t + 1) * porTarefa));
+    });
+
+    // Renumeração sequencial: componente 0 é a do menor índice, e assim por diante
+    vector<int> numero(n, -1);
+    rotulo.assign(n, -1);
+    if (tamanhos != nullptr)
+    {
+        tamanhos->clear();
+    }
+    int numComponentes = 0;
+    for (int v = 0; v < n; v++)
+    {
+        if (estaRemovido(v))
+        {
+            continue;
+        }
+        int raiz = pai[v].load(memory_order_relaxed);
+        if (numero[raiz] == -1)
+        {
+            numero[raiz] = numComponentes++;
+            if (tamanhos != nullptr)
+            {
+                tamanhos->push_back(0);
+            }
+        }
+        rotulo[v] = numero[raiz];
+        if (tamanhos != nullptr)
+        {
+            (*tamanhos)[rotulo[v]]++;
+        }
+    }
+    return numComponentes;
+}
+
+int Grafo::componentesFortes(vector<int> &rotulo, VisaoCSR *condensacao, int numThreads)
+{
+    ComponentesFortes fortes;
+    fortes.prepara(*this);
+    numThreads = Paralelo::resolveThreads(numThreads);
+    int numComponentes;
+    if (numThreads == 1 || numArestas < MIN_ENTRADAS_PARALELO)
+    {
+        numComponentes = fortes.tarjan(rotulo);
+    }
+    else
+    {
+        numComponentes = fortes.paralelo(rotulo, numThreads);
+    }
+    if (condensacao != nullptr)
+    {
+        fortes.condensacao(rotulo, numComponentes, *condensacao);
+    }
+    return numComponentes;
+}
+
+bool Grafo::ehCompleto()
+{
+    long long vivos = getOrdem();
+    long long maximo = vivos * (vivos - 1);
+    if (!direcionado)
+    {
+        maximo /= 2;
+    }
+    return numArestas - numLacos == maximo;
+}
+
+bool Grafo::ehArvore()
+{
+    // Os contadores descartam a maioria dos casos sem nenhuma busca
+    if (getOrdem() == 0 || numLacos != 0 || numArestas != getOrdem() - 1)
+    {
+        return false;
+    }
+    return nConexo() == 1;
+}
+
+bool Grafo::possuiPonte()
+{
+    return getPerfil().numPontes > 0;
+}
+
+bool Grafo::possuiArticulacao()
+{
+    return getPerfil().numArticulacoes > 0;
+}
+
+void Grafo::classificaPesos()
+{
+    if (versaoPesos == versao)
+    {
+        return;
+    }
+
+    const float limite = 4294967296.0f; // 2^32: somas de até 2^31 passos cabem em 64 bits
+    bool inteiros = true;
+    bool negativos = false;
+    for (int v = 0; v < ordem; v++)
+    {
+        float p = pesosNos[v];
+        inteiros = inteiros && fabs(p) < limite && p == floor(p);
+        negativos = negativos || p < 0;
+    }
+    for (No *no = primeiroNo; no != nullptr; no = no->getProxNo())
+    {
+        for (Aresta *aresta = no->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+        {
+            float p = aresta->getPeso();
+            inteiros = inteiros && fabs(p) < limite && p == floor(p);
+            negativos = negativos || p < 0;
+        }
+    }
+
+    pesosInteirosCache = inteiros;
+    pesosNegativosCache = negativos;
+    versaoPesos = versao;
+}
+
+bool Grafo::pesosInteiros()
+{
+    classificaPesos();
+    return pesosInteirosCache;
+}
+
+bool Grafo::pesosNegativos()
+{
+    classificaPesos();
+    return pesosNegativosCache;
+}
+
+bool Grafo::relaxaBellmanFord(vector<double> &distancia, vector<int> &anterior, int numThreads)
+{
+    const double infinito = numeric_limits<double>::infinity();
+    int n = ordem;
+    int vivos = ordem - numRemovidos; // Um caminho simples tem no máximo vivos - 1 arestas
+    anterior.assign(n, -1);
+    numThreads = Paralelo::resolveThreads(numThreads);
+
+    if (numThreads == 1 || (direcionado ? numArestas : 2 * numArestas) < MIN_ENTRADAS_PARALELO)
+    {
+        // SPFA: só os vértices cuja distância diminuiu voltam para a fila
+        vector<int> arestasNoCaminho(n, 0);
+        vector<char> naFila(n, 0);
+        deque<int> fila;
+        long long relaxacoes = 0;
+        for (int v = 0; v < n; v++)
+        {
+            if (distancia[v] != infinito)
+            {
+                fila.push_back(v);
+                naFila[v] = 1;
+            }
+        }
+        while (!fila.empty())
+        {
+            int u = fila.front();
+            fila.pop_front();
+            naFila[u] = 0;
+            for (Aresta *aresta = nos[u]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+            {
+                int v = aresta->getIdDestino();
+                double candidata = distancia[u] + aresta->getPeso() + pesosNos[v];
+                if (candidata < distancia[v])
+                {
+                    distancia[v] = candidata;
+                    anterior[v] = u;
+                    arestasNoCaminho[v] = arestasNoCaminho[u] + 1;
+                    if (arestasNoCaminho[v] >= vivos)
+                    {
+                        return false; // O caminho repete vértice e ainda diminui: ciclo negativo
+                    }
+                    if (++relaxacoes % n == 0 && predecessoresComCiclo(anterior))
+                    {
+                        return false;
+                    }
+                    if (!naFila[v])
+                    {
+                        fila.push_back(v);
+                        naFila[v] = 1;
+                    }
+                }
+            }
+        }
+        return true;
+    }
+
+    // Rodadas paralelas: cada vértice puxa a menor distância pelas arestas de entrada, lendo só a rodada
+    // anterior, de modo que as threads escrevem em faixas disjuntas sem sincronização
+    const VisaoCSR &adjacencia = transposta();
+
+    int numTarefas = numThreads * 4;
+    int porTarefa = (n + numTarefas - 1) / numTarefas;
+    vector<double> proxima(n);
+    vector<char> mudou(numTarefas);
+    for (int rodada = 0; rodada < vivos; rodada++)
+    {
+        fill(mudou.begin(), mudou.end(), 0);
+        Paralelo::executa(numTarefas, numThreads, [&](int t)
+        {
+            int fim = min(n, (t + 1) * porTarefa);
+            for (int v = t * porTarefa; v < fim; v++)
+            {
+                double melhor = distancia[v];
+                for (int k = adjacencia.inicio[v]; k < adjacencia.inicio[v + 1]; k++)
+                {
+                    int u = adjacencia.vizinhos[k];
+                    double candidata = distancia[u] + adjacencia.pesos[k] + pesosNos[v];
+                    if (candidata < melhor)
+                    {
+                        melhor = candidata;
+                        anterior[v] = u;
+                    }
+                }
+                proxima[v] = melhor;
+                if (melhor < distancia[v])
+                {
+                    mudou[t] = 1;
+                }
+            }
+        });
+        distancia.swap(proxima);
+        if (find(mudou.begin(), mudou.end(), 1) == mudou.end())
+        {
+            return true;
+        }
+        if (predecessoresComCiclo(anterior))
+        {
+            return false;
+        }
+    }
+    return false; // Ainda havia melhora depois de V rodadas (V vértices vivos): ciclo negativo
+}
+
+bool Grafo::bellmanFord(int origem, vector<double> &distancias, vector<int> *anterior, int numThreads)
+{
+    if (origem < 0 || origem >= ordem || estaRemovido(origem))
+    {
+        cout << "Erro: ID do nó inválido. Ordem atual: " << getOrdem() << endl;
+        return false;
+    }
+
+    distancias.assign(ordem, numeric_limits<double>::infinity());
+    distancias[origem] = pesosNos[origem];
+    vector<int> predecessores;
+    bool semCiclo = relaxaBellmanFord(distancias, predecessores, numThreads);
+    if (anterior != nullptr)
+    {
+        anterior->swap(predecessores);
+    }
+    return semCiclo;
+}
+
+bool Grafo::deltaStepping(int origem, vector<double> &distancias, double delta, int numThreads)
+{
+    const double infinito = numeric_limits<double>::infinity();
+    if (origem < 0 || origem >= ordem || estaRemovido(origem))
+    {
+        cout << "Erro: ID do nó inválido. Ordem atual: " << getOrdem() << endl;
+        return false;
+    }
+    if (pesosNegativos())
+    {
+        cout << "Erro: o delta-stepping exige pesos não negativos (use bellmanFord)." << endl;
+        return false;
+    }
+    numThreads = Paralelo::resolveThreads(numThreads);
+
+    // Custo de cada entrada da adjacência: peso da aresta mais o do vértice de chegada
+    VisaoCSR adjacencia = Grafo::visaoCSR();
+    int n = adjacencia.ordem;
+    vector<double> custo(adjacencia.numEntradas());
+    double maiorCusto = 0;
+    double somaCustos = 0;
+    for (int u = 0; u < n; u++)
+    {
+        for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
+        {
+            custo[k] = adjacencia.pesos[k] + pesosNos[adjacencia.vizinhos[k]];
+            maiorCusto = max(maiorCusto, custo[k]);
+            somaCustos += custo[k];
+        }
+    }
+    if (delta <= 0)
+    {
+        delta = somaCustos > 0 ? somaCustos / custo.size() : 1;
+    }
+
+    // Baldes circulares: cobrem ao menos o maior custo de aresta, de modo que uma relaxação nunca
+    // volta ao balde atual por engano; com menos baldes, entradas de voltas futuras ficam à espera
+    long long numBaldes = min(static_cast<long long>(maiorCusto / delta) + 2, MAX_BALDES);
+    vector<vector<int>> baldes(numBaldes);
+    vector<atomic<double>> distancia(n);
+    for (int v = 0; v < n; v++)
+    {
+        distancia[v].store(infinito, memory_order_relaxed);
     }
-    return false;
-}
+    distancia[origem].store(0, memory_order_relaxed);
+    baldes[0].push_back(origem);
+    long long pendentes = 1;
 
-bool Grafo::verticePonderado()
-{
-    No *no = primeiroNo;
-    while (no != nullptr)
+    int maxTarefas = numThreads == 1 ? 1 : numThreads * 4;
+    vector<vector<int>> alterados(maxTarefas);
+    auto relaxa = [&](const vector<int> &fronteira, bool leves)
     {
-        if (no->getPesoNo() != 0)
+        int tamanho = static_cast<int>(fronteira.size());
+        int numTarefas = tamanho < MIN_FRONTEIRA_PARALELA ? 1 : maxTarefas;
+        int porTarefa = (tamanho + numTarefas - 1) / numTarefas;
+        Paralelo::executa(numTarefas, numTarefas == 1 ? 1 : numThreads, [&](int t)
         {
-            return true;
+            int fim = min(tamanho, (t + 1) * porTarefa);
+            for (int i = t * porTarefa; i < fim; i++)
+            {
+                int u = fronteira[i];
+                double du = distancia[u].load(memory_order_relaxed);
+                for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
+                {
+                    if ((custo[k] <= delta) != leves)
+                    {
+                        continue;
+                    }
+                    int v = adjacencia.vizinhos[k];
+                    double candidata = du + custo[k];
+                    double atual = distancia[v].load(memory_order_relaxed);
+                    while (candidata < atual)
+                    {
+                        if (distancia[v].compare_exchange_weak(atual, candidata, memory_order_relaxed))
+                        {
+                            alterados[t].push_back(v);
+                            break;
+                        }
+                    }
+                }
+            }
+        });
+
+        // Os vértices melhorados entram no balde da nova distância (cópias antigas são descartadas depois)
+        for (int t = 0; t < numTarefas; t++)
+        {
+            for (int v : alterados[t])
+            {
+                long long b = static_cast<long long>(distancia[v].load(memory_order_relaxed) / delta);
+                baldes[b % numBaldes].push_back(v);
+                pendentes++;
+            }
+            alterados[t].clear();
         }
-        no = no->getProxNo();
-    }
-    return false;
-}
+    };
 
-bool Grafo::arestaPonderada()
-{
-    No *no = primeiroNo;
-    while (no != nullptr)
+    vector<int> fronteira;
+    vector<int> resolvidos;
+    vector<long long> marca(n, -1);       // Última fronteira que incluiu cada vértice
+    vector<long long> resolvidoEm(n, -1); // Último balde em que cada vértice foi resolvido
+    long long numFronteiras = 0;
+    for (long long atual = 0; pendentes > 0; atual++)
     {
-        Aresta *aresta = no->getPrimeiraAresta();
-        while (aresta != nullptr)
+        vector<int> &balde = baldes[atual % numBaldes];
+        resolvidos.clear();
+        while (true)
         {
-            if (aresta->getPeso() != 0)
+            // Separa as entradas do balde: as da volta atual formam a fronteira, as de voltas futuras ficam
+            fronteira.clear();
+            size_t ficam = 0;
+            for (int v : balde)
             {
-                return true;
+                long long b = static_cast<long long>(distancia[v].load(memory_order_relaxed) / delta);
+                if (b > atual)
+                {
+                    balde[ficam++] = v;
+                    continue;
+                }
+                pendentes--;
+                if (b == atual && marca[v] != numFronteiras)
+                {
+                    marca[v] = numFronteiras;
+                    fronteira.push_back(v);
+                }
             }
-            aresta = aresta->getProxAresta();
+            balde.resize(ficam);
+            if (fronteira.empty())
+            {
+                break;
+            }
+            numFronteiras++;
+            for (int v : fronteira)
+            {
+                if (resolvidoEm[v] != atual)
+                {
+                    resolvidoEm[v] = atual;
+                    resolvidos.push_back(v);
+                }
+            }
+            relaxa(fronteira, true);
+        }
+        if (!resolvidos.empty())
+        {
+            relaxa(resolvidos, false);
         }
-        no = no->getProxNo();
     }
-    return false;
-}
 
-No *Grafo::getNoPeloId(int id)
-{
-    No *no = primeiroNo;
-    while (no != nullptr)
+    distancias.resize(n);
+    for (int v = 0; v < n; v++)
     {
-        if (no->getIdNo() == id)
-        {
-            return no;
-        }
-        no = no->getProxNo();
+        double d = distancia[v].load(memory_order_relaxed);
+        distancias[v] = d == infinito ? infinito : d + pesosNos[origem];
     }
-    return nullptr;
+    return true;
 }
 
-int Grafo::getGrau(int vertice)
+bool Grafo::calculaPotenciais()
 {
-    No *no = primeiroNo;
-    while (no != nullptr)
+    if (versaoPotenciais != versao)
     {
-        if (no->getIdNo() == vertice)
+        // Fonte virtual com arestas de custo 0 para todos: todos começam com distância 0
+        potenciais.assign(ordem, 0);
+        for (int v = 0; v < ordem; v++)
         {
-            return no->getGrauSaida();
+            if (estaRemovido(v))
+            {
+                potenciais[v] = numeric_limits<double>::infinity();
+            }
         }
-        no = no->getProxNo();
+        vector<int> anterior;
+        cicloNegativo = !relaxaBellmanFord(potenciais, anterior, 0);
+        versaoPotenciais = versao;
     }
-    std::cout << "Vértice não encontrado";
-    return -1;
+    return !cicloNegativo;
 }
-void Grafo::novaAresta(int origem, int destino, float peso){    }
 
-bool Grafo::ehBipartido()
+double Grafo::menorDistancia(int origem, int destino, vector<int> *caminho)
 {
-    if (primeiroNo == nullptr)
+    const double infinito = numeric_limits<double>::infinity();
+    if (caminho != nullptr)
     {
-        return true;
+        caminho->clear();
     }
-
-    struct Fila
+    if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem || estaRemovido(origem) || estaRemovido(destino))
     {
-        No *no;
-        Fila *prox;
-    };
-
-    Fila *inicio = nullptr;
-    Fila *fim = nullptr;
+        return infinito;
+    }
 
-    auto enfileirar = [&](No *no)
+    double resultado;
+    vector<int> anterior;
+    verticesVisitados = 0;
+    if (!pesosNegativos() || calculaPotenciais())
     {
-        Fila *novo = new Fila;
-        novo->no = no;
-        novo->prox = nullptr;
-        if (inicio == nullptr)
+        const vector<double> *potencial = pesosNegativos() ? &potenciais : nullptr;
+        vector<double> distancia;
+        if (pesosInteiros())
         {
-            inicio = novo;
-            fim = novo;
+            resultado = buscaDijkstra<FilaRadix>(nos, pesosNos, potencial, origem, destino, distancia, anterior, verticesVisitados);
         }
         else
         {
-            fim->prox = novo;
-            fim = novo;
+            resultado = buscaDijkstra<FilaBinaria>(nos, pesosNos, potencial, origem, destino, distancia, anterior, verticesVisitados);
         }
-    };
-
-    auto desenfileirar = [&]() -> No *
-    {
-        if (inicio == nullptr)
+        resultado += pesosNos[origem];
+        if (potencial != nullptr)
         {
-            return nullptr;
+            resultado += potenciais[destino] - potenciais[origem];
         }
-        No *no = inicio->no;
-        Fila *temp = inicio;
-        inicio = inicio->prox;
-        if (inicio == nullptr)
+    }
+    else
+    {
+        vector<double> distancias;
+        if (!bellmanFord(origem, distancias, &anterior, 0))
         {
-            fim = nullptr;
+            cerr << "Erro: ciclo de custo negativo alcançável a partir do vértice " << origem << "." << endl;
+            return infinito;
         }
-        delete temp;
-        return no;
-    };
-
-    // Utilizando coloração para verificar se é bipartido, nesse caso utilizaremos 2 cores, 0 e 1, -1 para não colorido
+        resultado = distancias[destino];
+    }
 
-    int cores[getNumNos()];
-    for (int i = 0; i < getNumNos(); i++)
+    if (resultado != infinito && caminho != nullptr)
     {
-        cores[i] = -1;
+        montaCaminho(anterior, destino, ordem, *caminho);
     }
+    return resultado;
+}
 
-    No *noInicial = primeiroNo;
-    enfileirar(noInicial);
-    cores[noInicial->getIdNo()] = 1;
-
-    while (inicio != nullptr)
+bool Grafo::distanciasDijkstra(int origem, vector<double> &distancias, bool reverso)
+{
+    const double infinito = numeric_limits<double>::infinity();
+    if (origem < 0 || origem >= ordem || estaRemovido(origem))
+    {
+        cout << "Erro: ID do nó inválido. Ordem atual: " << getOrdem() << endl;
+        return false;
+    }
+    if (pesosNegativos())
     {
-        No *noAtual = desenfileirar();
+        cout << "Erro: o Dijkstra exige pesos não negativos (use bellmanFord)." << endl;
+        return false;
+    }
 
-        Aresta *aresta = noAtual->getPrimeiraAresta();
-        while (aresta != nullptr)
+    if (!reverso)
+    {
+        vector<int> anterior;
+        if (pesosInteiros())
         {
-            No *noAdjacente = getNoPeloId(aresta->getIdDestino());
-            if (cores[noAdjacente->getIdNo()] == -1)
+            buscaDijkstra<FilaRadix>(nos, pesosNos, nullptr, origem, -1, distancias, anterior, verticesVisitados);
+        }
+        else
+        {
+            buscaDijkstra<FilaBinaria>(nos, pesosNos, nullptr, origem, -1, distancias, anterior, verticesVisitados);
+        }
+        for (int v = 0; v < ordem; v++)
+        {
+            if (distancias[v] != infinito)
             {
-                cores[noAdjacente->getIdNo()] = 1 - cores[noAtual->getIdNo()];
-                enfileirar(noAdjacente);
+                distancias[v] += pesosNos[origem];
             }
-            else if (cores[noAdjacente->getIdNo()] == cores[noAtual->getIdNo()])
+        }
+        return true;
+    }
+
+    // Busca reversa: distancias[u] acumula o custo de u até a origem, sem o peso do próprio u
+    distancias.assign(ordem, infinito);
+    distancias[origem] = 0;
+    verticesVisitados = 0;
+    FilaBinaria fila;
+    fila.insere(0, origem);
+    const VisaoCSR &entrada = transposta();
+    while (!fila.vazia())
+    {
+        double d;
+        int v;
+        fila.removeMinimo(d, v);
+        if (d > distancias[v])
+        {
+            continue;
+        }
+        verticesVisitados++;
+        for (int k = entrada.inicio[v]; k < entrada.inicio[v + 1]; k++)
+        {
+            int u = entrada.vizinhos[k];
+            double candidata = d + entrada.pesos[k] + pesosNos[v];
+            if (candidata < distancias[u])
             {
-                return false;
+                distancias[u] = candidata;
+                fila.insere(candidata, u);
             }
-            aresta = aresta->getProxAresta();
         }
     }
-
+    for (int v = 0; v < ordem; v++)
+    {
+        if (distancias[v] != infinito)
+        {
+            distancias[v] += pesosNos[v];
+        }
+    }
     return true;
-
-    return false;
 }
 
-int Grafo::nConexo()
+bool Grafo::distanciasLote(const vector<int> &origens, const ConsumidorDistancias &consumidor, int numThreads)
 {
-    bool *visitado = new bool[ordem];
-    for (int i = 0; i < ordem; i++)
+    for (int origem : origens)
     {
-        visitado[i] = false;
+        if (origem < 0 || origem >= ordem || estaRemovido(origem))
+        {
+            cout << "Erro: ID do nó inválido no lote: " << origem << ". Ordem atual: " << getOrdem() << endl;
+            return false;
+        }
+    }
+    if (pesosNegativos() && !calculaPotenciais())
+    {
+        cout << "Erro: ciclo de custo negativo; as distâncias do lote não estão definidas." << endl;
+        return false;
+    }
+    if (origens.empty())
+    {
+        return true;
     }
 
-    int componentes = 0;
-
-    auto dfs = [this, &visitado](No *no, auto &dfsRef) -> void
+    // A adjacência e os custos são montados uma vez e compartilhados por todas as buscas do lote
+    const vector<double> *potencial = pesosNegativos() ? &potenciais : nullptr;
+    VisaoCSR adjacencia = Grafo::visaoCSR();
+    vector<double> custo(adjacencia.numEntradas());
+    for (int u = 0; u < adjacencia.ordem; u++)
     {
-        visitado[no->getIdNo()] = true;
-        Aresta *aresta = no->getPrimeiraAresta();
-        while (aresta != nullptr)
+        for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
         {
-            No *noAdjacente = this->getNoPeloId(aresta->getIdDestino());
-            if (!visitado[noAdjacente->getIdNo()])
+            int v = adjacencia.vizinhos[k];
+            custo[k] = adjacencia.pesos[k] + pesosNos[v];
+            if (potencial != nullptr)
             {
-                dfsRef(noAdjacente, dfsRef);
+                custo[k] += potenciais[u] - potenciais[v];
             }
-            aresta = aresta->getProxAresta();
         }
-    };
+    }
 
-    No *no = primeiroNo;
-    while (no != nullptr)
+    numThreads = min(Paralelo::resolveThreads(numThreads), static_cast<int>(origens.size()));
+    if (pesosInteiros())
     {
-        if (!visitado[no->getIdNo()])
-        {
-            componentes++;
-            dfs(no, dfs);
-        }
-        no = no->getProxNo();
+        verticesVisitados = loteDijkstra<FilaRadix>(adjacencia, custo, pesosNos, potencial, origens, numThreads, consumidor);
     }
-
-    delete[] visitado;
-    return componentes;
+    else
+    {
+        verticesVisitados = loteDijkstra<FilaBinaria>(adjacencia, custo, pesosNos, potencial, origens, numThreads, consumidor);
+    }
+    return true;
 }
 
-bool Grafo::ehCompleto()
+bool Grafo::distanciasLote(const vector<int> &origens, const string &arquivo, int numThreads)
 {
-    No *no = primeiroNo;
-    while (no != nullptr)
+    ofstream saida(arquivo, ios::binary | ios::trunc);
+    if (!saida.is_open())
+    {
+        cerr << "Erro: não foi possível gravar as distâncias do lote em " << arquivo << endl;
+        return false;
+    }
+
+    char bruto[TAMANHO_CABECALHO_LOTE] = {};
+    CabecalhoLote cabecalho;
+    memcpy(cabecalho.assinatura, ASSINATURA_LOTE, sizeof(ASSINATURA_LOTE));
+    cabecalho.numOrigens = static_cast<int32_t>(origens.size());
+    cabecalho.ordem = ordem;
+    memcpy(bruto, &cabecalho, sizeof(cabecalho));
+    saida.write(bruto, TAMANHO_CABECALHO_LOTE);
+    vector<int32_t> listaOrigens(origens.begin(), origens.end());
+    saida.write(reinterpret_cast<const char *>(listaOrigens.data()), static_cast<streamsize>(listaOrigens.size() * sizeof(int32_t)));
+
+    // As linhas chegam na ordem de conclusão; cada uma vai direto para a sua posição no arquivo
+    size_t inicioLinhas = TAMANHO_CABECALHO_LOTE + listaOrigens.size() * sizeof(int32_t);
+    size_t tamanhoLinha = static_cast<size_t>(ordem) * sizeof(float);
+    vector<float> linha(ordem);
+    bool calculou = distanciasLote(origens, [&](int posicao, int, const vector<double> &distancias)
     {
-        No *noAdjacente = primeiroNo;
-        while (noAdjacente != nullptr)
+        for (int v = 0; v < ordem; v++)
         {
-            if (no != noAdjacente)
-            {
-                Aresta *aresta = no->getPrimeiraAresta();
-                bool conectado = false;
-                while (aresta != nullptr)
-                {
-                    if (aresta->getIdDestino() == noAdjacente->getIdNo())
-                    {
-                        conectado = true;
-                        break;
-                    }
-                    aresta = aresta->getProxAresta();
-                }
-                if (!conectado)
-                {
-                    return false;
-                }
-            }
-            noAdjacente = noAdjacente->getProxNo();
+            linha[v] = static_cast<float>(distancias[v]);
         }
-        no = no->getProxNo();
+        saida.seekp(static_cast<streamoff>(inicioLinhas + posicao * tamanhoLinha));
+        saida.write(reinterpret_cast<const char *>(linha.data()), static_cast<streamsize>(tamanhoLinha));
+    }, numThreads);
+    bool gravou = static_cast<bool>(saida);
+    saida.close();
+    if (calculou && !gravou)
+    {
+        cerr << "Erro: não foi possível gravar as distâncias do lote em " << arquivo << endl;
+    }
+    if (!calculou || !gravou)
+    {
+        remove(arquivo.c_str()); // Não deixa um arquivo incompleto
+        return false;
     }
     return true;
-
-    return false;
 }
 
-bool Grafo::ehArvore()
+double Grafo::menorDistanciaBidirecional(int origem, int destino, vector<int> *caminho)
 {
-    return (nConexo() == 1 && (ordem - 1) == getNumNos());
-
-    return false;
-}
+    const double infinito = numeric_limits<double>::infinity();
+    if (pesosNegativos())
+    {
+        return menorDistancia(origem, destino, caminho);
+    }
+    if (caminho != nullptr)
+    {
+        caminho->clear();
+    }
+    if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem || estaRemovido(origem) || estaRemovido(destino))
+    {
+        return infinito;
+    }
 
-bool Grafo::possuiPonte()
-{
-    No *no = primeiroNo;
-    while (no != nullptr)
+    // ida[v]: custo da origem até v; volta[v]: custo de v até o destino (ambos sem o peso do vértice de partida)
+    typedef pair<double, int> Entrada;
+    priority_queue<Entrada, vector<Entrada>, greater<Entrada>> filaIda, filaVolta;
+    vector<double> ida(ordem, infinito), volta(ordem, infinito);
+    vector<int> anterior(ordem, -1), posterior(ordem, -1);
+    vector<char> fechadoIda(ordem, 0), fechadoVolta(ordem, 0);
+    ida[origem] = 0;
+    volta[destino] = 0;
+    filaIda.push(Entrada(0, origem));
+    filaVolta.push(Entrada(0, destino));
+    double melhor = origem == destino ? 0 : infinito;
+    int encontro = origem;
+    verticesVisitados = 0;
+
+    const VisaoCSR &entrada = transposta();
+    while (true)
     {
-        Aresta *aresta = no->getPrimeiraAresta();
-        while (aresta != nullptr)
+        while (!filaIda.empty() && fechadoIda[filaIda.top().second])
         {
-            int origem = no->getIdNo();
-            int destino = aresta->getIdDestino();
-
-            bool *visitado = new bool[ordem];
-            for (int i = 0; i < ordem; i++)
-            {
-                visitado[i] = false;
-            }
+            filaIda.pop();
+        }
+        while (!filaVolta.empty() && fechadoVolta[filaVolta.top().second])
+        {
+            filaVolta.pop();
+        }
+        // Nenhum caminho ainda não visto pode custar menos que a soma dos dois topos
+        if (filaIda.empty() || filaVolta.empty() || filaIda.top().first + filaVolta.top().first >= melhor)
+        {
+            break;
+        }
 
-            auto dfs = [this, &visitado, origem, destino](No *noAtual, auto &dfsRef) -> void
+        if (filaIda.top().first <= filaVolta.top().first)
+        {
+            int u = filaIda.top().second;
+            filaIda.pop();
+            fechadoIda[u] = 1;
+            verticesVisitados++;
+            for (Aresta *aresta = nos[u]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
             {
-                visitado[noAtual->getIdNo()] = true;
-                Aresta *arestaAtual = noAtual->getPrimeiraAresta();
-                while (arestaAtual != nullptr)
+                int v = aresta->getIdDestino();
+                double candidata = ida[u] + aresta->getPeso() + pesosNos[v];
+                if (candidata < ida[v])
                 {
-                    int adj = arestaAtual->getIdDestino();
-                    if ((noAtual->getIdNo() == origem && adj == destino) || 
-                        (noAtual->getIdNo() == destino && adj == origem))
+                    ida[v] = candidata;
+                    anterior[v] = u;
+                    filaIda.push(Entrada(candidata, v));
+                    if (candidata + volta[v] < melhor)
                     {
-                        arestaAtual = arestaAtual->getProxAresta();
-                        continue;
+                        melhor = candidata + volta[v];
+                        encontro = v;
                     }
-                    No *noAdjacente = this->getNoPeloId(adj);
-                    if (!visitado[noAdjacente->getIdNo()])
+                }
+            }
+        }
+        else
+        {
+            int v = filaVolta.top().second;
+            filaVolta.pop();
+            fechadoVolta[v] = 1;
+            verticesVisitados++;
+            for (int k = entrada.inicio[v]; k < entrada.inicio[v + 1]; k++)
+            {
+                int u = entrada.vizinhos[k];
+                double candidata = volta[v] + entrada.pesos[k] + pesosNos[v];
+                if (candidata < volta[u])
+                {
+                    volta[u] = candidata;
+                    posterior[u] = v;
+                    filaVolta.push(Entrada(candidata, u));
+                    if (ida[u] + candidata < melhor)
                     {
-                        dfsRef(noAdjacente, dfsRef);
+                        melhor = ida[u] + candidata;
+                        encontro = u;
                     }
-                    arestaAtual = arestaAtual->getProxAresta();
                 }
-            };
-
-            dfs(no, dfs);
-
-            if (!visitado[destino])
-            {
-                delete[] visitado;
-                return true;
             }
+        }
+    }
 
-            delete[] visitado;
-            aresta = aresta->getProxAresta();
+    if (melhor == infinito)
+    {
+        return infinito;
+    }
+    if (caminho != nullptr)
+    {
+        montaCaminho(anterior, encontro, ordem, *caminho);
+        for (int v = posterior[encontro]; v != -1 && static_cast<int>(caminho->size()) <= ordem; v = posterior[v])
+        {
+            caminho->push_back(v);
         }
-        no = no->getProxNo();
     }
-    return false;
+    return melhor + pesosNos[origem];
 }
 
-bool Grafo::possuiArticulacao()
+double Grafo::menorDistanciaAEstrela(int origem, int destino, const Heuristica &heuristica, vector<int> *caminho)
 {
-    int componentesOriginais = nConexo();
-
-    No *no = primeiroNo;
-    while (no != nullptr)
+    const double infinito = numeric_limits<double>::infinity();
+    if (pesosNegativos())
+    {
+        return menorDistancia(origem, destino, caminho);
+    }
+    if (caminho != nullptr)
     {
-        int idNo = no->getIdNo();
+        caminho->clear();
+    }
+    if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem || estaRemovido(origem) || estaRemovido(destino))
+    {
+        return infinito;
+    }
 
-        bool *visitado = new bool[ordem];
-        for (int i = 0; i < ordem; i++)
+    // A fila é ordenada pelo custo conhecido mais a estimativa do restante
+    typedef pair<double, int> Entrada;
+    priority_queue<Entrada, vector<Entrada>, greater<Entrada>> fila;
+    vector<double> custo(ordem, infinito);
+    vector<int> anterior(ordem, -1);
+    vector<char> fechado(ordem, 0);
+    custo[origem] = 0;
+    fila.push(Entrada(heuristica.estimativa(origem, destino), origem));
+    verticesVisitados = 0;
+    while (!fila.empty())
+    {
+        int u = fila.top().second;
+        fila.pop();
+        if (fechado[u])
         {
-            visitado[i] = false;
+            continue;
         }
-
-        No *noInicial = (no == primeiroNo) ? no->getProxNo() : primeiroNo;
-        auto dfs = [this, &visitado, idNo](No *noAtual, auto &dfsRef) -> void
+        fechado[u] = 1;
+        verticesVisitados++;
+        if (u == destino)
+        {
+            break;
+        }
+        for (Aresta *aresta = nos[u]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
         {
-            visitado[noAtual->getIdNo()] = true;
-            Aresta *aresta = noAtual->getPrimeiraAresta();
-            while (aresta != nullptr)
+            int v = aresta->getIdDestino();
+            double candidata = custo[u] + aresta->getPeso() + pesosNos[v];
+            if (candidata < custo[v])
             {
-                No *noAdjacente = this->getNoPeloId(aresta->getIdDestino());
-                if (noAdjacente->getIdNo() != idNo && !visitado[noAdjacente->getIdNo()])
+                double estimativa = heuristica.estimativa(v, destino);
+                if (estimativa == infinito)
                 {
-                    dfsRef(noAdjacente, dfsRef);
+                    continue; // O destino não é alcançável a partir de v
                 }
-                aresta = aresta->getProxAresta();
+                custo[v] = candidata;
+                anterior[v] = u;
+                fila.push(Entrada(candidata + estimativa, v));
             }
-        };
+        }
+    }
 
-        dfs(noInicial, dfs);
+    if (!fechado[destino])
+    {
+        return infinito;
+    }
+    if (caminho != nullptr)
+    {
+        montaCaminho(anterior, destino, ordem, *caminho);
+    }
+    return custo[destino] + pesosNos[origem];
+}
 
-        int componentes = 0;
-        for (int i = 0; i < ordem; i++)
+void Grafo::todasDistancias(MatrizDistancias &distancias, int numThreads)
+{
+    VisaoCSR adjacencia = Grafo::visaoCSR(); // Pesos exatos das listas de arestas, em qualquer backend
+    int n = adjacencia.ordem;
+    distancias.redimensiona(n);
+    for (int u = 0; u < n; u++)
+    {
+        if (estaRemovido(u))
         {
-            if (!visitado[i] && getNoPeloId(i) != nullptr)
-            {
-                componentes++;
-                dfs(getNoPeloId(i), dfs);
-            }
+            continue;
         }
-
-        delete[] visitado;
-
-        if (componentes > componentesOriginais)
+        float *linha = distancias.linha(u);
+        linha[u] = 0;
+        for (int k = adjacencia.inicio[u]; k < adjacencia.inicio[u + 1]; k++)
         {
-            return true;
+            int v = adjacencia.vizinhos[k];
+            linha[v] = min(linha[v], adjacencia.pesos[k] + pesosNos[v]);
         }
-
-        no = no->getProxNo();
     }
-    return false;
+    fechaDistancias(distancias, numThreads);
 }
 
-int Grafo::menorDistancia(int origem, int destino)
+void Grafo::fechaDistancias(MatrizDistancias &distancias, int numThreads)
 {
-    int *distancia = new int[ordem];
-    bool *visitado = new bool[ordem];
-
-    for (int i = 0; i < ordem; i++)
-    {
-        distancia[i] = INT_MAX;
-        visitado[i] = false;
-    }
-
-    No *noOrigem = getNoPeloId(origem);
-    distancia[origem] = noOrigem->getPesoNo();
+    distancias.floydWarshall(numThreads);
 
-    for (int count = 0; count < ordem - 1; count++)
+    // Com o peso do vértice de chegada já somado a cada aresta, falta só o peso da origem
+    int n = distancias.getOrdem();
+    for (int u = 0; u < n; u++)
     {
-        int min = INT_MAX;
-        int minIndex = -1;
-
-        for (int v = 0; v < ordem; v++)
+        if (pesosNos[u] == 0)
         {
-            if (!visitado[v] && distancia[v] <= min)
-            {
-                min = distancia[v];
-                minIndex = v;
-            }
+            continue;
         }
-
-        if (minIndex == -1)
-            break;
-        visitado[minIndex] = true;
-
-        No *noAtual = getNoPeloId(minIndex);
-        Aresta *aresta = noAtual->getPrimeiraAresta();
-
-        while (aresta)
+        float *linha = distancias.linha(u);
+        for (int v = 0; v < n; v++)
         {
-            int v = aresta->getIdDestino();
-            No *noDestino = getNoPeloId(v);
-
-            if (!visitado[v] &&
-                distancia[minIndex] != INT_MAX &&
-                distancia[minIndex] + aresta->getPeso() + noDestino->getPesoNo() < distancia[v])
-            {
-
-                distancia[v] = distancia[minIndex] + aresta->getPeso() + noDestino->getPesoNo();
-            }
-            aresta = aresta->getProxAresta();
+            linha[v] += pesosNos[u]; // INFINITO permanece INFINITO
         }
     }
-
-    int resultado = distancia[destino];
-    delete[] distancia;
-    delete[] visitado;
-
-    return resultado == INT_MAX ? -1 : resultado;
 }
 
 float Grafo::getPesoAresta(int origem, int destino)
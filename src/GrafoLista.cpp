@@ -11,19 +11,43 @@
  using namespace std;
  
  GrafoLista::GrafoLista(int ordem, bool direcionado, bool ponderadoVertices, bool ponderadoArestas)
-     : Grafo(ordem, direcionado, ponderadoVertices, ponderadoArestas)
+     : Grafo(ordem, direcionado, ponderadoVertices, ponderadoArestas), listaAdj(nullptr), capacidade(0), arenaEntradas(sizeof(No))
  {
-     listaAdj = new Lista[ordem];
-     nos = new No*[ordem];
-     for (int i = 0; i < ordem; i++) {
-         nos[i] = new No(i);
-     }
-     numArestas = 0;
+     DadosGrafo vazio;
+     vazio.ordem = ordem;
+     vazio.direcionado = direcionado;
+     vazio.ponderadoVertices = ponderadoVertices;
+     vazio.ponderadoArestas = ponderadoArestas;
+     constroiGrafo(vazio);
  }
 
  GrafoLista::~GrafoLista()
  {
-     // Se necessário, a limpeza é feita automaticamente em ~Lista()
+     // Os nós pertencem à lista de nós da classe base
+     liberaListas();
+ }
+
+ Lista *GrafoLista::criaListas(int quantidade)
+ {
+     Lista *listas = new Lista[quantidade];
+     for (int i = 0; i < quantidade; i++)
+     {
+         listas[i].usaArena(&arenaEntradas);
+     }
+     return listas;
+ }
+
+ void GrafoLista::liberaListas()
+ {
+     // As entradas ficam todas na arena: as listas só as esquecem e os blocos são devolvidos juntos
+     for (int i = 0; i < capacidade; i++)
+     {
+         listaAdj[i].solta();
+     }
+     delete[] listaAdj;
+     listaAdj = nullptr;
+     capacidade = 0;
+     arenaEntradas.liberaTudo();
  }
 
  int* GrafoLista::construcaoGulosa(int* tamanhoCobertura) {
@@ -31,9 +55,12 @@
     int* cobertura = new int[ordem];
     *tamanhoCobertura = 0;
 
-    // Inicialização 
+    // Grau residual (vizinhos ainda não cobertos) de cada vértice, a partir do vetor de graus:
+    // a escolha percorre só esse vetor, e cobrir um vértice atualiza apenas quem aponta para ele
+    vector<int> grauResidual(ordem);
     for(int i = 0; i < ordem; i++) {
         verticesCobertos[i] = false;
+        grauResidual[i] = static_cast<int>(grausSaida[i]);
     }
 
     bool todasArestasCoberta = false;
@@ -43,18 +70,8 @@
         int verticeEscolhido = -1;
         
         for(int i = 0; i < ordem; i++) {
-            if(verticesCobertos[i]) continue;
-            
-            int grau = 0;
-            for(int j = 0; j < listaAdj[i].getTamanho(); j++) {
-                int adj = listaAdj[i].getElemento(j)->getIdNo();
-                if(!verticesCobertos[adj]) {
-                    grau++;
-                }
-            }
-            
-            if(grau > maxGrau) {
-                maxGrau = grau;
+            if(!verticesCobertos[i] && grauResidual[i] > maxGrau) {
+                maxGrau = grauResidual[i];
                 verticeEscolhido = i;
             }
         }
@@ -65,15 +82,24 @@
         cobertura[(*tamanhoCobertura)++] = verticeEscolhido;
         verticesCobertos[verticeEscolhido] = true;
 
+        // Quem tem o vértice escolhido na lista perde um vizinho não coberto
+        if(direcionado) {
+            const vector<int>& entrada = predecessores[verticeEscolhido];
+            for(size_t k = 0; k < entrada.size(); k++) {
+                grauResidual[entrada[k]]--;
+            }
+        } else {
+            for(No* adj = listaAdj[verticeEscolhido].getPrimeiro(); adj != nullptr; adj = adj->getProxNo()) {
+                grauResidual[adj->getIdNo()]--;
+            }
+        }
+
         // Verifica se todas as arestas estão cobertas
         todasArestasCoberta = true;
-        for(int i = 0; i < ordem && todasArestasCoberta; i++) {
-            for(int j = 0; j < listaAdj[i].getTamanho(); j++) {
-                int adj = listaAdj[i].getElemento(j)->getIdNo();
-                if(!verticesCobertos[i] && !verticesCobertos[adj]) {
-                    todasArestasCoberta = false;
-                    break;
-                }
+        for(int i = 0; i < ordem; i++) {
+            if(!verticesCobertos[i] && grauResidual[i] > 0) {
+                todasArestasCoberta = false;
+                break;
             }
         }
     }
@@ -82,342 +108,182 @@
     return cobertura;
 }
 
- bool GrafoLista::ehCompleto()
+ VisaoCSR GrafoLista::visaoCSR()
  {
-     for (int i = 0; i < ordem; i++)
+     std::vector<ArestaLida> arestas;
+     arestas.reserve(direcionado ? numArestas : 2 * numArestas);
+     for (int v = 0; v < ordem; v++)
      {
-         if (listaAdj[i].getTamanho() != ordem - 1)
+         for (No *adj = listaAdj[v].getPrimeiro(); adj != nullptr; adj = adj->getProxNo())
          {
-             return false;
+             ArestaLida aresta = {v, adj->getIdNo(), adj->getPesoNo()};
+             arestas.push_back(aresta);
          }
      }
-     return true;
+     VisaoCSR visao;
+     visao.constroi(ordem, arestas, true); // as listas já guardam os dois sentidos
+     return visao;
  }
 
- int GrafoLista::nConexo()
+ void GrafoLista::constroiEstrutura(const VisaoCSR &adjacencia)
  {
-     bool *visitado = new bool[ordem];
-     for (int i = 0; i < ordem; ++i)
-     {
-         visitado[i] = false;
-     }
- 
-     int componentes = 0;
- 
-     auto dfs = [&](int v, auto &dfsRef) -> void
-     {
-         visitado[v] = true;
-         for (int i = 0; i < listaAdj[v].getTamanho(); ++i)
-         {
-             int adj = listaAdj[v].getElemento(i)->getIdNo();
-             if (!visitado[adj])
-             {
-                 dfsRef(adj, dfsRef);
-             }
-         }
-     };
- 
-     for (int i = 0; i < ordem; ++i)
+     liberaListas();
+     listaAdj = criaListas(ordem);
+     capacidade = ordem;
+     for (int v = 0; v < ordem; v++)
      {
-         if (!visitado[i])
-         {
-             componentes++;
-             dfs(i, dfs);
-         }
+         int inicio = adjacencia.inicio[v];
+         listaAdj[v].preenche(adjacencia.vizinhos.data() + inicio, adjacencia.pesos.data() + inicio, adjacencia.grau(v));
      }
- 
-     delete[] visitado;
-     return componentes;
  }
 
- bool GrafoLista::ehArvore()
- {
-     return (nConexo() == 1 && (ordem - 1) == numArestas);
- }
-
- bool GrafoLista::possuiPonte()
+ void GrafoLista::deleta_no(int idNo)
  {
-     for (int u = 0; u < ordem; u++)
+     if (idNo < 0 || idNo >= ordem || estaRemovido(idNo))
      {
-         for (int i = 0; i < listaAdj[u].getTamanho(); ++i)
-         {
-             int v = listaAdj[u].getElemento(i)->getIdNo();
- 
-             listaAdj[u].remover(v);
-             if (!direcionado)
-             {
-                 listaAdj[v].remover(u);
-             }
-             bool *visitado = new bool[ordem];
-             for (int j = 0; j < ordem; ++j)
-             {
-                 visitado[j] = false;
-             }
- 
-             auto dfs = [&](int vertice, auto &dfsRef) -> void
-             {
-                 visitado[vertice] = true;
-                 for (int k = 0; k < listaAdj[vertice].getTamanho(); ++k)
-                 {
-                     int adj = listaAdj[vertice].getElemento(k)->getIdNo();
-                     if (!visitado[adj])
-                     {
-                         dfsRef(adj, dfsRef);
-                     }
-                 }
-             };
- 
-             int componentes = 0;
-             for (int j = 0; j < ordem; j++)
-             {
-                 if (!visitado[j])
-                 {
-                     componentes++;
-                     dfs(j, dfs);
-                 }
-             }
- 
-             delete[] visitado;
-             listaAdj[u].adicionar(v);
-             if (!direcionado)
-             {
-                 listaAdj[v].adicionar(u);
-             }
- 
-             if (componentes > 1)
-             {
-                 return true;
-             }
-         }
+         cout << "Erro: ID do nó inválido." << endl;
+         return;
      }
  
-     return false;
- }
-
- bool GrafoLista::possuiArticulacao()
- {
-     bool *visitado = new bool[ordem];
-     int componentesOriginais = nConexo();
+     long long idExterno = getIdExterno(idNo);
+     cout << "Removendo nó " << idExterno << " da lista de adjacência..." << endl;
+     registraAlteracao();
  
-     for (int v = 0; v < ordem; v++)
+     // Marca o nó como removido e retira só as entradas incidentes; os índices dos demais
+     // nós só mudam na compactação
+     vector<int> saida, entrada;
+     marcaRemovido(idNo, saida, entrada);
+     listaAdj[idNo].limpa();
+     if (!direcionado)
      {
-         for (int i = 0; i < ordem; ++i)
-         {
-             visitado[i] = false;
-         }
-         visitado[v] = true;
- 
-         int componentes = 0;
-         for (int u = 0; u < ordem; u++)
-         {
-             if (!visitado[u])
-             {
-                 componentes++;
-                 auto dfs = [&](int x, auto &dfsRef) -> void
-                 {
-                     visitado[x] = true;
-                     for (int i = 0; i < listaAdj[x].getTamanho(); ++i)
-                     {
-                         int adj = listaAdj[x].getElemento(i)->getIdNo();
-                         if (!visitado[adj])
-                         {
-                             dfsRef(adj, dfsRef);
-                         }
-                     }
-                 };
-                 dfs(u, dfs);
-             }
-         }
- 
-         if (componentes > componentesOriginais)
+         for (size_t k = 0; k < saida.size(); k++)
          {
-             delete[] visitado;
-             return true;
+             listaAdj[saida[k]].remover(idNo);
          }
      }
+     for (size_t k = 0; k < entrada.size(); k++)
+     {
+         listaAdj[entrada[k]].remover(idNo);
+     }
+     compactaSeNecessario();
  
-     delete[] visitado;
-     return false;
+     cout << "Nó " << idExterno << " removido com sucesso! Nova ordem: " << getOrdem() << endl;
  }
 
- void GrafoLista::carregaGrafo(const std::string &arquivo)
+ void GrafoLista::compactaEstrutura(const vector<int> &novoIndice, int novaOrdem)
  {
-     std::ifstream file(arquivo);
-     if (!file.is_open())
-     {
-         std::cerr << "Erro ao abrir o arquivo " << arquivo << std::endl;
-         return;
-     }
- 
-     int numNos, direcionado, ponderadoVertices, ponderadoArestas;
-     file >> numNos >> direcionado >> ponderadoVertices >> ponderadoArestas;
- 
-     this->ordem = numNos;
-     this->direcionado = direcionado;
-     this->ponderadoVertices = ponderadoVertices;
-     this->ponderadoArestas = ponderadoArestas;
- 
-     if (ponderadoVertices)
+     // Monta as novas listas já com os índices renumerados
+     Lista *novaListaAdj = criaListas(novaOrdem);
+     vector<int> ids;
+     vector<float> pesos;
+     for (int i = 0; i < ordem; i++)
      {
-         std::cout << "Pesos dos vértices:" << std::endl;
-         for (int i = 0; i < numNos; i++)
+         if (novoIndice[i] == -1)
          {
-             int pesoVertice;
-             file >> pesoVertice;
-             std::cout << "Vértice " << i + 1 << ": Peso " << pesoVertice << std::endl;
+             continue;
          }
-     }
- 
-     delete[] listaAdj;
-     listaAdj = new Lista[numNos];
  
-     int origem, destino, peso;
-     while (file >> origem >> destino >> peso)
-     {
-         origem--;
-         destino--;
-         listaAdj[origem].adicionar(destino);
-         if (!direcionado)
+         ids.clear();
+         pesos.clear();
+         for (No *adj = listaAdj[i].getPrimeiro(); adj != nullptr; adj = adj->getProxNo())
          {
-             listaAdj[destino].adicionar(origem);
+             ids.push_back(novoIndice[adj->getIdNo()]);
+             pesos.push_back(adj->getPesoNo());
          }
-         std::cout << "Aresta adicionada: " << origem + 1 << " -> " << destino + 1 << " com peso " << peso << std::endl;
+         novaListaAdj[novoIndice[i]].preenche(ids.data(), pesos.data(), static_cast<int>(ids.size()));
      }
  
-     file.close();
-     std::cout << "Lista de Adjacência carregada com sucesso." << std::endl;
+     delete[] listaAdj;
+     listaAdj = novaListaAdj;
+     capacidade = novaOrdem;
  }
 
- void GrafoLista::novoGrafo(const std::string &arquivoConfig)
+ void GrafoLista::reservaNos(int novaOrdem)
  {
-     std::ifstream file(arquivoConfig);
-     if (!file.is_open())
+     if (novaOrdem <= capacidade)
      {
-         std::cerr << "Erro ao abrir o arquivo de configuração!" << std::endl;
          return;
      }
  
-     std::string tipo;
-     file >> tipo; // Ignora "matriz" ou "lista"
-     file >> ordem >> direcionado >> ponderadoVertices >> ponderadoArestas;
-     delete[] listaAdj;
-     listaAdj = new Lista[ordem];
- 
-     int origem, destino, peso;
-     while (file >> origem >> destino >> peso)
+     // As listas são trocadas, não copiadas: o custo é proporcional ao número de listas
+     int novaCapacidade = capacidade * 2 > novaOrdem ? capacidade * 2 : novaOrdem;
+     Lista *novaListaAdj = criaListas(novaCapacidade);
+     for (int i = 0; i < ordem; i++)
      {
-         listaAdj[origem].adicionar(destino);
-         if (!direcionado)
-         {
-             listaAdj[destino].adicionar(origem);
-         }
+         novaListaAdj[i].troca(listaAdj[i]);
      }
- 
-     file.close();
-     std::cout << "Novo grafo configurado como " << tipo << "." << std::endl;
+     delete[] listaAdj;
+     listaAdj = novaListaAdj;
+     capacidade = novaCapacidade;
  }
 
- void GrafoLista::deleta_no(int idNo)
+ void GrafoLista::aplicaLote(const VisaoCSR &lote, bool remocao)
  {
-     if (idNo <= 0 || idNo > ordem)
-     {
-         cout << "Erro: ID do nó inválido." << endl;
-         return;
-     }
- 
-     idNo--; // Ajustar para zero-based
- 
-     cout << "Removendo nó " << idNo + 1 << " da lista de adjacência..." << endl;
- 
-     // Remover todas as conexões do nó que será deletado
-     for (int i = 0; i < ordem; i++)
+     // Cada lista tocada é percorrida e reconstruída uma única vez: as entradas do lote substituem
+     // (ou, na remoção, descartam) as existentes com o mesmo destino
+     vector<char> noLote(ordem, 0);
+     vector<int> ids;
+     vector<float> pesos;
+     for (int v = 0; v < ordem; v++)
      {
-         if (i != idNo)
+         if (lote.grau(v) == 0)
          {
-             listaAdj[i].remover(idNo);
- 
-             // Atualizar os IDs das conexões maiores que idNo
-             for (int j = 0; j < listaAdj[i].getTamanho(); j++)
-             {
-                 No *no = listaAdj[i].getElemento(j);
-                 if (no->getIdNo() > idNo)
-                 {
-                     no->setIDNo(no->getIdNo() - 1);
-                 }
-             }
+             continue;
          }
-     }
- 
-     // Criar nova lista de adjacência sem o nó removido
-     Lista *novaListaAdj = new Lista[ordem - 1];
- 
-     // Copiar e ajustar os IDs
-     int novoIndice = 0;
-     for (int i = 0; i < ordem; i++)
-     {
-         if (i == idNo)
+         for (int k = lote.inicio[v]; k < lote.inicio[v + 1]; k++)
          {
-             continue;
+             noLote[lote.vizinhos[k]] = 1;
          }
  
-         // Copiar as conexões ajustando os IDs
-         for (int j = 0; j < listaAdj[i].getTamanho(); j++)
+         ids.clear();
+         pesos.clear();
+         for (No *adj = listaAdj[v].getPrimeiro(); adj != nullptr; adj = adj->getProxNo())
          {
-             int adj = listaAdj[i].getElemento(j)->getIdNo();
-             if (adj > idNo)
+             if (!noLote[adj->getIdNo()])
              {
-                 adj--; // Decrementar IDs maiores que o nó removido
+                 ids.push_back(adj->getIdNo());
+                 pesos.push_back(adj->getPesoNo());
              }
-             if (adj != idNo)
+         }
+         for (int k = lote.inicio[v]; k < lote.inicio[v + 1]; k++)
+         {
+             if (!remocao)
              {
-                 novaListaAdj[novoIndice].adicionar(adj);
+                 ids.push_back(lote.vizinhos[k]);
+                 pesos.push_back(lote.pesos[k]);
              }
+             noLote[lote.vizinhos[k]] = 0;
          }
-         novoIndice++;
+         listaAdj[v].preenche(ids.data(), pesos.data(), static_cast<int>(ids.size()));
      }
- 
-     // Liberar a memória da antiga lista de adjacência
-     delete[] listaAdj;
- 
-     // Atualizar a estrutura do grafo
-     listaAdj = novaListaAdj;
-     ordem--;
- 
-     cout << "Nó " << idNo + 1 << " removido com sucesso! Nova ordem: " << ordem << endl;
  }
 
  void GrafoLista::adicionaNo(int idNo)
  {
-     if (idNo < 0 || idNo >= ordem)
+     if (idNo < 0 || idNo >= ordem || estaRemovido(idNo))
      {
          cout << "Erro: ID do nó inválido. " << endl;
          return;
      }
  
-     cout << "Adicionando nó " << idNo << " à lista de adjacência..." << endl;
+     cout << "Adicionando nó ligado a " << getIdExterno(idNo) << " à lista de adjacência..." << endl;
+     registraAlteracao();
  
-     // Criar nova lista de adjacência com o novo nó
-     Lista *novaListaAdj = new Lista[ordem + 1];
+     // O vetor de listas cresce geometricamente; as listas existentes não são copiadas
+     reservaNos(ordem + 1);
+     int novoNo = ordem;
+     ordem++;
+     anexaNo(0);
  
-     for (int i = 0; i < ordem; i++)
+     // O novo nó é ligado ao nó informado
+     listaAdj[novoNo].adicionar(idNo);
+     if (!direcionado)
      {
-         for (int j = 0; j < listaAdj[i].getTamanho(); j++)
-         {
-             novaListaAdj[i].adicionar(listaAdj[i].getElemento(j)->getIdNo());
-         }
+         listaAdj[idNo].adicionar(novoNo);
      }
+     ligaNos(novoNo, idNo, 0);
  
-     // Adicionar o novo nó
-     novaListaAdj[ordem].adicionar(idNo);
- 
-     // Liberar a memória da antiga lista de adjacência
-     delete[] listaAdj;
- 
-     // Atualizar a estrutura do grafo
-     listaAdj = novaListaAdj;
-     ordem++;
- 
-     cout << "Nó " << idNo << " adicionado com sucesso! Nova ordem: " << ordem << endl;
+     cout << "Nó " << getIdExterno(novoNo) << " adicionado com sucesso! Nova ordem: " << getOrdem() << endl;
  }
 
  void GrafoLista::removeAresta(int idNoOrigem, int idNoDestino, bool direcionado) 
@@ -428,31 +294,47 @@
          return;
      }
  
-     listaAdj[idNoOrigem].remover(idNoDestino);
-     listaAdj[idNoOrigem].getElemento(idNoOrigem)->removeAresta(idNoDestino, direcionado);
+     registraAlteracao();
+     desligaNos(idNoOrigem, idNoDestino);
  
-     if (!direcionado)
+     listaAdj[idNoOrigem].remover(idNoDestino);
+     if (!direcionado && idNoOrigem != idNoDestino)
      {
          listaAdj[idNoDestino].remover(idNoOrigem);
-         listaAdj[idNoOrigem].getElemento(idNoOrigem)->removeAresta(idNoOrigem, direcionado);
      }
  }
 
  void GrafoLista::novaAresta(int origem, int destino, float peso)
  {
-     if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem)
+     if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem || estaRemovido(origem) || estaRemovido(destino))
      {
          std::cerr << "Erro: Índices de vértices inválidos." << std::endl;
          return;
      }
  
+     registraAlteracao();
+ 
+     // Aresta já existente: apenas atualiza o peso, sem duplicar a entrada
+     bool existia = listaAdj[origem].contem(destino);
+     if (existia)
+     {
+         desligaNos(origem, destino);
+         listaAdj[origem].remover(destino);
+         if (!direcionado && origem != destino)
+         {
+             listaAdj[destino].remover(origem);
+         }
+     }
+ 
      listaAdj[origem].adicionar(destino, peso);
  
-     if (!direcionado)
+     if (!direcionado && origem != destino)
      {
          listaAdj[destino].adicionar(origem, peso);
      }
  
+     ligaNos(origem, destino, peso);
+ 
      std::cout << "Aresta adicionada: " << origem << " -> " << destino;
      if (ponderadoArestas)
      {
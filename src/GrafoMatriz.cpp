@@ -6,397 +6,255 @@
 #include "../include/GrafoMatriz.h"
 #include <fstream>
 #include <iostream>
+#include <cstdint>
+#include <algorithm>
+#include <cstring>
 #include "../include/No.h"
+#include "../include/VarreduraLinha.h"
 
 using namespace std;
 
-GrafoMatriz::GrafoMatriz(int ordem, bool direcionado, bool ponderadoVertices, bool ponderadoArestas) : Grafo(ordem, direcionado, ponderadoVertices, ponderadoArestas), matrizAdj(nullptr), nos(nullptr)
+GrafoMatriz::GrafoMatriz(int ordem, bool direcionado, bool ponderadoVertices, bool ponderadoArestas) : Grafo(ordem, direcionado, ponderadoVertices, ponderadoArestas), matrizAdj(nullptr), capacidade(0), passo(0), memoriaMatriz(nullptr), dadosMatriz(nullptr)
 {
-    this->capacidade = 10;
-    matrizAdj = new int *[capacidade];
-    for (int i = 0; i < capacidade; ++i)
-    {
-        matrizAdj[i] = new int[capacidade]();
-    }
+    DadosGrafo vazio;
+    vazio.ordem = ordem;
+    vazio.direcionado = direcionado;
+    vazio.ponderadoVertices = ponderadoVertices;
+    vazio.ponderadoArestas = ponderadoArestas;
+    constroiGrafo(vazio);
 }
 
 GrafoMatriz::~GrafoMatriz()
 {
-    if (matrizAdj != nullptr)
-    {
-        for (int i = 0; i < capacidade; ++i)
-        {
-            delete[] matrizAdj[i];
-        }
-        delete[] matrizAdj;
-    }
-
-    if (nos != nullptr)
-    {
-        for (int i = 0; i < ordem; ++i)
-        {
-            delete nos[i];
-        }
-        delete[] nos;
-    }
+    // Os nós pertencem à lista de nós da classe base
+    liberaMatriz();
 }
 
-bool GrafoMatriz::ehCompleto()
+void GrafoMatriz::liberaMatriz()
 {
-    for (int i = 0; i < ordem; i++)
-    {
-        for (int j = 0; j < ordem; j++)
-        {
-            if (i != j && matrizAdj[i][j] == 0)
-            {
-                return false;
-            }
-        }
-    }
-    return true;
+    delete[] matrizAdj;
+    ::operator delete(memoriaMatriz);
+    matrizAdj = nullptr;
+    memoriaMatriz = nullptr;
+    dadosMatriz = nullptr;
+    capacidade = 0;
+    passo = 0;
 }
 
-int GrafoMatriz::nConexo()
+void GrafoMatriz::realocaMatriz(int novaCapacidade)
 {
-    bool *visitado = new bool[ordem];
-    for (int i = 0; i < ordem; ++i)
+    // Um único bloco para a matriz inteira; a folga de ALINHAMENTO_MATRIZ bytes permite alinhar o início
+    int novoPasso = (novaCapacidade + ALINHAMENTO_LINHA - 1) / ALINHAMENTO_LINHA * ALINHAMENTO_LINHA;
+    size_t bytes = static_cast<size_t>(novoPasso) * novaCapacidade * sizeof(int);
+    void *novaMemoria = ::operator new(bytes + ALINHAMENTO_MATRIZ);
+    uintptr_t endereco = reinterpret_cast<uintptr_t>(novaMemoria);
+    endereco = (endereco + ALINHAMENTO_MATRIZ - 1) & ~static_cast<uintptr_t>(ALINHAMENTO_MATRIZ - 1);
+    int *novosDados = reinterpret_cast<int *>(endereco);
+    memset(novosDados, 0, bytes);
+
+    int **novasLinhas = new int *[novaCapacidade];
+    for (int i = 0; i < novaCapacidade; i++)
     {
-        visitado[i] = false;
+        novasLinhas[i] = novosDados + static_cast<size_t>(i) * novoPasso;
     }
 
-    int componentes = 0;
-
-    auto dfs = [&](int v, auto &dfsRef) -> void
+    // Copia as células ocupadas, linha a linha
+    int copiar = ordem < capacidade ? ordem : capacidade;
+    if (copiar > novaCapacidade)
     {
-        visitado[v] = true;
-        for (int i = 0; i < ordem; ++i)
-        {
-            if (matrizAdj[v][i] && !visitado[i])
-            {
-                dfsRef(i, dfsRef);
-            }
-        }
-    };
-
-    for (int i = 0; i < ordem; ++i)
+        copiar = novaCapacidade;
+    }
+    for (int i = 0; i < copiar; i++)
     {
-        if (!visitado[i])
-        {
-            componentes++;
-            dfs(i, dfs);
-        }
+        memcpy(novasLinhas[i], matrizAdj[i], copiar * sizeof(int));
     }
 
-    delete[] visitado;
-    return componentes;
+    liberaMatriz();
+    matrizAdj = novasLinhas;
+    memoriaMatriz = novaMemoria;
+    dadosMatriz = novosDados;
+    capacidade = novaCapacidade;
+    passo = novoPasso;
 }
 
-bool GrafoMatriz::ehArvore()
+void GrafoMatriz::pesosDaLinha(int vertice, vector<float> &pesos) const
 {
-    return (nConexo() == 1 && (numNos - 1) == getOrdem());
+    for (Aresta *aresta = nos[vertice]->getPrimeiraAresta(); aresta != nullptr; aresta = aresta->getProxAresta())
+    {
+        pesos[aresta->getIdDestino()] = aresta->getPeso();
+    }
 }
 
-bool GrafoMatriz::possuiPonte()
+VisaoCSR GrafoMatriz::visaoCSR()
 {
-    for (int u = 0; u < numNos; u++)
+    std::vector<ArestaLida> arestas;
+    arestas.reserve(direcionado ? numArestas : 2 * numArestas);
+    vector<float> pesos(ordem, 0);
+    for (int i = 0; i < ordem; i++)
     {
-        for (int v = 0; v < numNos; v++)
+        const int *linha = matrizAdj[i];
+        pesosDaLinha(i, pesos);
+        for (int j = VarreduraLinha::proximoNaoNulo(linha, 0, ordem); j < ordem; j = VarreduraLinha::proximoNaoNulo(linha, j + 1, ordem))
         {
-            if (matrizAdj[u][v])
-            {
-                matrizAdj[u][v] = 0;
-                if (nConexo() > 1)
-                {
-                    matrizAdj[u][v] = 1;
-                    return true;
-                }
-                matrizAdj[u][v] = 1;
-            }
+            ArestaLida aresta = {i, j, pesos[j]};
+            arestas.push_back(aresta);
         }
     }
-    return false;
+    VisaoCSR visao;
+    visao.constroi(ordem, arestas, true); // a matriz já guarda os dois sentidos
+    return visao;
 }
 
-bool GrafoMatriz::possuiArticulacao()
+void GrafoMatriz::todasDistancias(MatrizDistancias &distancias, int numThreads)
 {
-    bool *visitado = new bool[numNos];
-    int componentesOriginais = nConexo();
-
-    for (int v = 0; v < numNos; v++)
+    distancias.redimensiona(ordem);
+    vector<float> pesos(ordem, 0);
+    for (int i = 0; i < ordem; i++)
     {
-        for (int i = 0; i < numNos; ++i)
-        {
-            visitado[i] = false;
-        }
-        visitado[v] = true;
-
-        int componentes = 0;
-        for (int u = 0; u < numNos; u++)
+        if (estaRemovido(i))
         {
-            if (!visitado[u])
-            {
-                componentes++;
-                auto dfs = [&](int x, auto &dfsRef) -> void
-                {
-                    visitado[x] = true;
-                    for (int i = 0; i < numNos; i++)
-                    {
-                        if (matrizAdj[x][i] && !visitado[i])
-                        {
-                            dfsRef(i, dfsRef);
-                        }
-                    }
-                };
-                dfs(u, dfs);
-            }
+            continue;
         }
-
-        if (componentes > componentesOriginais)
+        const int *linhaAdj = matrizAdj[i];
+        float *linha = distancias.linha(i);
+        linha[i] = 0;
+        pesosDaLinha(i, pesos);
+        for (int j = VarreduraLinha::proximoNaoNulo(linhaAdj, 0, ordem); j < ordem; j = VarreduraLinha::proximoNaoNulo(linhaAdj, j + 1, ordem))
         {
-            delete[] visitado;
-            return true;
+            linha[j] = min(linha[j], pesos[j] + pesosNos[j]);
         }
     }
-
-    delete[] visitado;
-    return false;
+    fechaDistancias(distancias, numThreads);
 }
 
-void GrafoMatriz::carregaGrafo(const std::string &arquivo)
+void GrafoMatriz::constroiEstrutura(const VisaoCSR &adjacencia)
 {
-    std::ifstream file(arquivo);
-    if (!file.is_open())
-    {
-        std::cerr << "Erro ao abrir o arquivo " << arquivo << std::endl;
-        return;
-    }
-
-    int numNos, direcionado, ponderadoVertices, ponderadoArestas;
-    file >> numNos >> direcionado >> ponderadoVertices >> ponderadoArestas;
-
-    this->ordem = numNos;
-    this->direcionado = direcionado;
-    this->ponderadoVertices = ponderadoVertices;
-    this->ponderadoArestas = ponderadoArestas;
-
-    if (ponderadoVertices)
-    {
-        std::cout << "Pesos dos vértices:" << std::endl;
-        for (int i = 0; i < numNos; i++)
-        {
-            int pesoVertice;
-            file >> pesoVertice;
-            std::cout << "Vértice " << i + 1 << ": Peso " << pesoVertice << std::endl;
-        }
-    }
-
-    matrizAdj = new int *[numNos];
-    for (int i = 0; i < numNos; ++i)
-    {
-        matrizAdj[i] = new int[numNos];
-        for (int j = 0; j < numNos; ++j)
-        {
-            matrizAdj[i][j] = 0;
-        }
-    }
+    liberaMatriz();
+    realocaMatriz(ordem > 10 ? ordem : 10);
 
-    int origem, destino, peso;
-    while (file >> origem >> destino >> peso)
+    for (int v = 0; v < ordem; v++)
     {
-        origem--; // Ajusta para índices baseados em 0
-        destino--;
-        matrizAdj[origem][destino] = peso;
-        if (!direcionado)
+        int *linha = matrizAdj[v];
+        for (int k = adjacencia.inicio[v]; k < adjacencia.inicio[v + 1]; k++)
         {
-            matrizAdj[destino][origem] = peso;
+            linha[adjacencia.vizinhos[k]] = 1; // O peso fica na lista de arestas do nó
         }
-        std::cout << "Aresta adicionada: " << origem + 1 << " -> " << destino + 1 << " com peso " << peso << std::endl;
     }
-
-    file.close();
-    std::cout << "Matriz de Adjacência carregada com sucesso." << std::endl;
 }
 
-void GrafoMatriz::novoGrafo(const std::string &arquivoConfig)
+void GrafoMatriz::deleta_no(int idNo)
 {
-    std::ifstream file(arquivoConfig);
-    if (!file.is_open())
+    if (idNo < 0 || idNo >= ordem || estaRemovido(idNo))
     {
-        std::cerr << "Erro ao abrir o arquivo de configuração: " << arquivoConfig << std::endl;
+        cout << "Erro: ID do nó inválido. Ordem atual: " << getOrdem() << endl;
         return;
     }
 
-    std::string estrutura;
-    file >> estrutura; // Lê a estrutura (matriz ou lista)
+    long long idExterno = getIdExterno(idNo);
+    cout << "Removendo nó " << idExterno << " da matriz de adjacência...\n";
+    registraAlteracao();
 
-    file >> ordem >> direcionado >> ponderadoVertices >> ponderadoArestas;
-    matrizAdj = new int *[ordem];
-    for (int i = 0; i < ordem; ++i)
+    // Marca o nó como removido e desfaz só as arestas incidentes; a linha e a coluna ficam
+    // zeradas no lugar até a compactação
+    vector<int> saida, entrada;
+    marcaRemovido(idNo, saida, entrada);
+    for (size_t k = 0; k < saida.size(); k++)
     {
-        matrizAdj[i] = new int[ordem];
-        for (int j = 0; j < ordem; ++j)
-        {
-            matrizAdj[i][j] = 0;
-        }
-    }
-
-    nos = new No *[ordem];
-    if (ponderadoVertices)
-    {
-        for (int i = 0; i < ordem; ++i)
-        {
-            float pesoNo;
-            file >> pesoNo;
-            nos[i] = new No(i, pesoNo);
-        }
-    }
-    else
-    {
-        for (int i = 0; i < ordem; ++i)
+        matrizAdj[idNo][saida[k]] = 0;
+        if (!direcionado)
         {
-            nos[i] = new No(i, 0.0f);
+            matrizAdj[saida[k]][idNo] = 0;
         }
     }
-
-    int origem, destino, peso;
-    while (file >> origem >> destino >> peso)
+    for (size_t k = 0; k < entrada.size(); k++)
     {
-        origem--;
-        destino--;
-        matrizAdj[origem][destino] = peso;
-        if (!direcionado)
-        {
-            matrizAdj[destino][origem] = peso;
-        }
+        matrizAdj[entrada[k]][idNo] = 0;
     }
+    compactaSeNecessario();
 
-    file.close();
-    std::cout << "Novo grafo configurado como " << estrutura << "." << std::endl;
+    cout << "Nó " << idExterno << " removido com sucesso! Nova ordem: " << getOrdem() << endl;
 }
 
-void GrafoMatriz::deleta_no(int idNo)
+void GrafoMatriz::compactaEstrutura(const vector<int> &novoIndice, int novaOrdem)
 {
-    if (idNo < 0 || idNo >= ordem)
-    {
-        cout << "Erro: ID do nó inválido. Ordem atual: " << ordem << endl;
-        return;
-    }
-
-    cout << "Removendo nó " << idNo << " da matriz de adjacência...\n";
-
-    // Atualizar IDs dos nós e suas arestas
-    for (int i = idNo; i < ordem - 1; i++)
+    // Move linhas e colunas para frente em uma única passada; como novoIndice é crescente,
+    // nenhuma posição é sobrescrita antes de ser lida. A capacidade é mantida.
+    for (int i = 0; i < ordem; i++)
     {
-        No *no = getNoPeloId(i + 1);
-        no->setIDNo(i);
-
-        // Atualizar IDs das arestas que apontam para nós com índices maiores que idNo
-        Aresta *aresta = no->getPrimeiraAresta();
-        while (aresta != nullptr)
+        if (novoIndice[i] == -1)
         {
-            int destino = aresta->getIdDestino();
-            if (destino > idNo)
+            continue;
+        }
+        const int *origem = matrizAdj[i];
+        int *destino = matrizAdj[novoIndice[i]];
+        for (int j = 0; j < ordem; j++)
+        {
+            if (novoIndice[j] != -1)
             {
-                // Atualiza o ID de destino da aresta
-                No *novoDestino = getNoPeloId(destino - 1);
-                aresta->setNoDestino(novoDestino);
+                destino[novoIndice[j]] = origem[j];
             }
-            aresta = aresta->getProxAresta();
         }
-    }
-
-    // Remover todas as arestas que apontam para o nó a ser removido
-    for (int i = 0; i < ordem; i++)
-    {
-        if (i != idNo)
+        for (int j = novaOrdem; j < ordem; j++)
         {
-            No *no = getNoPeloId(i);
-            no->removeAresta(idNo, direcionado);
+            destino[j] = 0;
         }
     }
-
-    // Criar nova matriz reduzida
-    int novaOrdem = ordem - 1;
-    int **novaMatriz = new int *[novaOrdem];
-
-    for (int i = 0, ni = 0; i < ordem; i++)
+    for (int i = novaOrdem; i < ordem; i++)
     {
-        if (i == idNo)
-            continue;
-
-        novaMatriz[ni] = new int[novaOrdem];
-
-        for (int j = 0, nj = 0; j < ordem; j++)
-        {
-            if (j == idNo)
-                continue;
-            novaMatriz[ni][nj] = matrizAdj[i][j];
-            nj++;
-        }
-        ni++;
+        memset(matrizAdj[i], 0, ordem * sizeof(int));
     }
+}
 
-    // Liberar a matriz antiga
-    for (int i = 0; i < ordem; i++)
+void GrafoMatriz::adicionaNo(int idNo)
+{
+    if (idNo < 0 || idNo >= ordem || estaRemovido(idNo))
     {
-        delete[] matrizAdj[i];
+        cout << "Erro: ID do nó inválido." << endl;
+        return;
     }
-    delete[] matrizAdj;
 
-    // Atualizar estrutura
-    matrizAdj = novaMatriz;
-    ordem = novaOrdem;
+    cout << "Adicionando nó à matriz de adjacência...\n";
+    registraAlteracao();
 
-    cout << "Nó " << idNo << " removido com sucesso! Nova ordem: " << ordem << endl;
+    // Verifica se precisa aumentar a capacidade
+    reservaNos(ordem + 1);
+
+    // Incrementa a ordem do grafo
+    ordem++;
+    anexaNo(0);
+    cout << "Nó " << getIdExterno(ordem - 1) << " adicionado com sucesso! Nova ordem: " << getOrdem() << endl;
 }
 
-void GrafoMatriz::adicionaNo(int idNo)
+void GrafoMatriz::reservaNos(int novaOrdem)
 {
-    if (idNo < 0 || idNo >= ordem)
+    if (novaOrdem <= capacidade)
     {
-        cout << "Erro: ID do nó inválido." << endl;
         return;
     }
 
-    cout << "Adicionando nó " << idNo << " à matriz de adjacência...\n";
+    int novaCapacidade = capacidade * 2 > novaOrdem ? capacidade * 2 : novaOrdem;
+    cout << "Expandindo matriz de " << capacidade << " para " << novaCapacidade << endl;
+    realocaMatriz(novaCapacidade);
+}
 
-    // Verifica se precisa aumentar a capacidade
-    if (ordem >= capacidade)
+void GrafoMatriz::aplicaLote(const VisaoCSR &lote, bool remocao)
+{
+    // O lote já traz os dois sentidos das arestas não direcionadas
+    for (int v = 0; v < ordem; v++)
     {
-        int novaCapacidade = capacidade * 2;
-        cout << "Expandindo matriz de " << capacidade << " para " << novaCapacidade << endl;
-
-        // Cria nova matriz com capacidade dobrada
-        int **novaMatriz = new int *[novaCapacidade];
-        for (int i = 0; i < novaCapacidade; ++i)
+        int *linha = matrizAdj[v];
+        for (int k = lote.inicio[v]; k < lote.inicio[v + 1]; k++)
         {
-            novaMatriz[i] = new int[novaCapacidade]();
-
-            // Copia dados existentes
-            if (i < ordem)
+            if (remocao)
             {
-                for (int j = 0; j < ordem; ++j)
-                {
-                    novaMatriz[i][j] = matrizAdj[i][j];
-                }
+                linha[lote.vizinhos[k]] = 0;
+            }
+            else
+            {
+                linha[lote.vizinhos[k]] = 1;
             }
         }
-
-        // Libera matriz antiga
-        for (int i = 0; i < capacidade; ++i)
-        {
-            delete[] matrizAdj[i];
-        }
-        delete[] matrizAdj;
-
-        // Atualiza para nova matriz
-        matrizAdj = novaMatriz;
-        capacidade = novaCapacidade;
     }
-
-    // Incrementa a ordem do grafo
-    ordem++;
-    cout << "Nó " << idNo << " adicionado com sucesso! Nova ordem: " << ordem << endl;
 }
 
 void GrafoMatriz::removeAresta(int idNoOrigem, int idNoDestino, bool direcionado)
@@ -407,19 +265,18 @@ void GrafoMatriz::removeAresta(int idNoOrigem, int idNoDestino, bool direcionado
         return;
     }
 
+    registraAlteracao();
+    desligaNos(idNoOrigem, idNoDestino);
     matrizAdj[idNoOrigem][idNoDestino] = 0;
     if (!direcionado)
     {
         matrizAdj[idNoDestino][idNoOrigem] = 0;
-        nos[idNoOrigem]->removeAresta(idNoDestino, direcionado);
     }
-
-    nos[idNoOrigem]->removeAresta(idNoDestino, direcionado);
 }
 
 void GrafoMatriz::novaAresta(int origem, int destino, float peso)
 {
-    if (origem < 0 || origem >= numNos || destino < 0 || destino >= numNos)
+    if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem || estaRemovido(origem) || estaRemovido(destino))
     {
         std::cout << "Parâmetros errados!" << std::endl;
         return;
@@ -431,22 +288,20 @@ void GrafoMatriz::novaAresta(int origem, int destino, float peso)
         return;
     }
 
-    if (ponderadoArestas)
+    registraAlteracao();
+    bool existia = matrizAdj[origem][destino] != 0;
+    matrizAdj[origem][destino] = 1;
+    if (!direcionado)
     {
-        matrizAdj[origem][destino] = peso;
-        if (!direcionado)
-        {
-            matrizAdj[destino][origem] = peso;
-        }
+        matrizAdj[destino][origem] = 1;
     }
-    else
+
+    // O peso fica só nas arestas dos nós (uma aresta existente tem o peso substituído)
+    if (existia)
     {
-        matrizAdj[origem][destino] = 1;
-        if (!direcionado)
-        {
-            matrizAdj[destino][origem] = 1;
-        }
+        desligaNos(origem, destino);
     }
+    ligaNos(origem, destino, peso);
 }
 
 int *GrafoMatriz::coberturaArestas(float alpha, int maxIteracoes, int *tamanhoCobertura)
@@ -486,26 +341,26 @@ int *GrafoMatriz::coberturaArestas(float alpha, int maxIteracoes, int *tamanhoCo
 
 int *GrafoMatriz::construcaoGulosa(int *tamanhoCobertura)
 {
-    bool *coberto = new bool[ordem];
-    for (int i = 0; i < ordem; i++)
-    {
-        coberto[i] = false;
-    }
+    // Marcas em int, com a mesma largura das células, para a varredura vetorial das linhas
+    vector<int> coberto(ordem, 0);
 
     int *cobertura = new int[ordem];
     int tamanhoAtual = 0;
 
     for (int i = 0; i < ordem; i++)
     {
-        for (int j = 0; j < ordem; j++)
+        if (coberto[i])
         {
-            if (matrizAdj[i][j] && !coberto[i] && !coberto[j])
-            {
-                cobertura[tamanhoAtual++] = i;
-                cobertura[tamanhoAtual++] = j;
-                coberto[i] = true;
-                coberto[j] = true;
-            }
+            continue;
+        }
+        // Primeira aresta de i com a outra ponta ainda livre
+        int j = VarreduraLinha::proximoLivre(matrizAdj[i], coberto.data(), 0, ordem);
+        if (j < ordem)
+        {
+            cobertura[tamanhoAtual++] = i;
+            cobertura[tamanhoAtual++] = j;
+            coberto[i] = 1;
+            coberto[j] = 1;
         }
     }
 
@@ -548,46 +403,49 @@ bool GrafoMatriz::verificarCobertura(int *cobertura, int tamanhoCobertura)
 }
 
 int* GrafoMatriz::construcaoGulosaRandomizada(float alpha, int* tamanhoCobertura) {
-    bool* verticesCobertos = new bool[ordem];
+    vector<int> verticesCobertos(ordem, 0);
     int* cobertura = new int[ordem];
     *tamanhoCobertura = 0;
 
-    // Inicialização
-    for(int i = 0; i < ordem; i++) {
-        verticesCobertos[i] = false;
-    }
-
     // Cache para armazenar graus
-    int* grausCache = new int[ordem];
-    
-    bool todasArestasCoberta = false;
-    while(!todasArestasCoberta) {
-        // Atualiza cache de graus
-        int maxGrau = -1;
+    vector<int> grausCache(ordem, 0);
+    vector<int> candidatos;
+
+    while(true) {
+        // Atualiza cache de graus (vizinhos ainda não cobertos de cada vértice livre)
+        int maxGrau = 0;
         int minGrau = ordem + 1;
-        
+
         for(int i = 0; i < ordem; i++) {
             if(verticesCobertos[i]) {
                 grausCache[i] = 0;
                 continue;
             }
-            
-            grausCache[i] = 0;
-            for(int j = 0; j < ordem; j++) {
-                if(matrizAdj[i][j] && !verticesCobertos[j]) {
-                    grausCache[i]++;
-                }
-            }
-            
+
+            grausCache[i] = VarreduraLinha::contaLivres(matrizAdj[i], verticesCobertos.data(), ordem);
+
             if(grausCache[i] > maxGrau) maxGrau = grausCache[i];
             if(grausCache[i] < minGrau && grausCache[i] > 0) minGrau = grausCache[i];
         }
 
-        // Resto do código...
+        // Nenhum vértice livre com vizinho livre: todas as arestas estão cobertas
+        if(maxGrau == 0) break;
+
+        // Lista restrita de candidatos: graus a partir do limiar
+        int limiar = minGrau + (int)(alpha * (maxGrau - minGrau));
+        candidatos.clear();
+        for(int i = 0; i < ordem; i++) {
+            if(!verticesCobertos[i] && grausCache[i] >= limiar) {
+                candidatos.push_back(i);
+            }
+        }
+
+        // Seleciona candidato aleatoriamente
+        int escolhido = candidatos[rand() % candidatos.size()];
+        cobertura[(*tamanhoCobertura)++] = escolhido;
+        verticesCobertos[escolhido] = 1;
     }
 
-    delete[] verticesCobertos;
-    delete[] grausCache;
     return cobertura;
 }
 
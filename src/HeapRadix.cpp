@@ -0,0 +1,68 @@
+/**
+ * @file HeapRadix.cpp
+ * @brief Implementação da fila de prioridade radix.
+ */
+
+#include "../include/HeapRadix.h"
+
+using namespace std;
+
+HeapRadix::HeapRadix() : ultima(0), tamanho(0)
+{
+}
+
+int HeapRadix::balde(unsigned long long chave) const
+{
+    unsigned long long diferenca = chave ^ ultima;
+    return diferenca == 0 ? 0 : 64 - __builtin_clzll(diferenca);
+}
+
+void HeapRadix::insere(unsigned long long chave, int valor)
+{
+    baldes[balde(chave)].push_back(make_pair(chave, valor));
+    tamanho++;
+}
+
+void HeapRadix::removeMinimo(unsigned long long &chave, int &valor)
+{
+    if (baldes[0].empty())
+    {
+        // Esvazia o primeiro balde não vazio: sua menor chave passa a ser a última, e os demais
+        // elementos dele caem em baldes estritamente menores
+        int i = 1;
+        while (baldes[i].empty())
+        {
+            i++;
+        }
+        vector<pair<unsigned long long, int>> &origem = baldes[i];
+        unsigned long long menor = origem[0].first;
+        for (size_t k = 1; k < origem.size(); k++)
+        {
+            if (origem[k].first < menor)
+            {
+                menor = origem[k].first;
+            }
+        }
+        ultima = menor;
+        for (size_t k = 0; k < origem.size(); k++)
+        {
+            baldes[balde(origem[k].first)].push_back(origem[k]);
+        }
+        origem.clear();
+    }
+
+    chave = baldes[0].back().first;
+    valor = baldes[0].back().second;
+    baldes[0].pop_back();
+    tamanho--;
+}
+
+void HeapRadix::limpa()
+{
+    for (int i = 0; i < NUM_BALDES; i++)
+    {
+        baldes[i].clear();
+    }
+    ultima = 0;
+    tamanho = 0;
+}
@@ -0,0 +1,99 @@
+/**
+ * @file HeuristicaALT.cpp
+ * @brief Implementação da heurística ALT: escolha dos marcos e estimativa pela desigualdade triangular.
+ */
+
+#include "../include/HeuristicaALT.h"
+#include "../include/Grafo.h"
+#include <algorithm>
+#include <limits>
+
+using namespace std;
+
+namespace
+{
+    /// Limite a - b, com infinito quando só a é infinito e 0 (sem informação) quando b é infinito.
+    double limite(double a, double b)
+    {
+        const double infinito = numeric_limits<double>::infinity();
+        if (b == infinito)
+        {
+            return 0;
+        }
+        return a == infinito ? infinito : a - b;
+    }
+}
+
+HeuristicaALT::HeuristicaALT() : ordem(0)
+{
+}
+
+bool HeuristicaALT::prepara(Grafo &grafo, int numMarcos)
+{
+    const double infinito = numeric_limits<double>::infinity();
+    marcos.clear();
+    doMarco.clear();
+    ateMarco.clear();
+    ordem = grafo.getNumIndices();
+
+    int inicial = 0;
+    while (inicial < ordem && grafo.estaRemovido(inicial))
+    {
+        inicial++;
+    }
+    if (inicial == ordem)
+    {
+        return true;
+    }
+
+    // O primeiro marco é o vértice mais distante de um vértice qualquer; os seguintes, o mais distante
+    // dos marcos já escolhidos (vértices que nenhum marco alcança vêm primeiro)
+    vector<double> distancias;
+    if (!grafo.distanciasDijkstra(inicial, distancias))
+    {
+        return false;
+    }
+    vector<double> proximidade(distancias);
+    numMarcos = min(numMarcos, grafo.getOrdem());
+    for (int k = 0; k < numMarcos; k++)
+    {
+        int marco = -1;
+        for (int v = 0; v < ordem; v++)
+        {
+            if (!grafo.estaRemovido(v) && find(marcos.begin(), marcos.end(), v) == marcos.end() &&
+                (marco == -1 || proximidade[v] > proximidade[marco]))
+            {
+                marco = v;
+            }
+        }
+        marcos.push_back(marco);
+
+        // Distâncias sem o peso do vértice de partida (a diferença entre dois caminhos o anularia de qualquer forma)
+        grafo.distanciasDijkstra(marco, distancias);
+        float pesoMarco = grafo.getNoPeloId(marco)->getPesoNo();
+        for (int v = 0; v < ordem; v++)
+        {
+            doMarco.push_back(distancias[v] - pesoMarco);
+            proximidade[v] = k == 0 ? distancias[v] : min(proximidade[v], distancias[v]);
+        }
+        grafo.distanciasDijkstra(marco, distancias, true);
+        for (int v = 0; v < ordem; v++)
+        {
+            ateMarco.push_back(distancias[v] == infinito ? infinito : distancias[v] - grafo.getNoPeloId(v)->getPesoNo());
+        }
+    }
+    return true;
+}
+
+double HeuristicaALT::estimativa(int v, int destino) const
+{
+    double melhor = 0;
+    for (size_t k = 0; k < marcos.size(); k++)
+    {
+        const double *de = &doMarco[k * ordem];
+        const double *ate = &ateMarco[k * ordem];
+        melhor = max(melhor, limite(de[destino], de[v]));
+        melhor = max(melhor, limite(ate[v], ate[destino]));
+    }
+    return melhor;
+}
@@ -0,0 +1,753 @@
+/**
+ * @file HierarquiaContracao.cpp
+ * @brief Implementação da hierarquia de contração: ordenação, contração com buscas de testemunha, consulta e arquivo.
+ */
+
+#include "../include/HierarquiaContracao.h"
+#include "../include/Grafo.h"
+#include "../include/CacheAnalise.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <queue>
+
+using namespace std;
+
+namespace
+{
+    typedef HierarquiaContracao::Arco Arco;
+    typedef pair<double, int> Entrada;
+    typedef priority_queue<Entrada, vector<Entrada>, greater<Entrada>> FilaMinima;
+
+    const char ASSINATURA[8] = {'G', 'R', 'C', 'H', '0', '0', '0', '1'};
+    const size_t TAMANHO_CABECALHO = 64;
+
+    /// Cabeçalho do arquivo do índice (ocupa os primeiros TAMANHO_CABECALHO bytes).
+    struct Cabecalho
+    {
+        char assinatura[8];
+        unsigned long long impressao;
+        int ordem;
+        int vivos;
+        int numSobe;
+        int numDesce;
+        int numAtalhos;
+        int tamanhoNucleo;
+    };
+
+    /// Trecho de caminho de para ate pelo intermediário meio (-1 se for uma aresta original).
+    struct Trecho
+    {
+        int de;
+        int ate;
+        int meio;
+    };
+
+    /// Vértices fechados por uma busca de testemunha ao simular uma contração (só estima a prioridade).
+    const int LIMITE_SIMULACAO = 50;
+
+    /// Vértices fechados por uma busca de testemunha na contração (sem testemunha, o atalho é criado).
+    const int LIMITE_TESTEMUNHA = 500;
+
+    /// A contração para, deixando um núcleo, quando os atalhos passam deste múltiplo dos arcos originais.
+    const int FATOR_ATALHOS = 2;
+
+    /**
+     * @brief Grafo restante durante a contração: arcos entre os vértices ainda não contraídos.
+     */
+    class Contracao
+    {
+    public:
+        vector<vector<Arco>> saida;   ///< Arcos v -> w para vértices não contraídos.
+        vector<vector<Arco>> entrada; ///< Arcos u -> v vindos de vértices não contraídos.
+        int atalhos;                  ///< Atalhos criados até agora.
+
+        explicit Contracao(int n)
+            : saida(n), entrada(n), atalhos(0), distancia(n, numeric_limits<double>::infinity()), marcaAlvo(n, 0), rodada(0)
+        {
+        }
+
+        /// Registra o arco u -> w, mantendo só o mais barato entre os repetidos.
+        void insereArco(int u, int w, double custo, int meio)
+        {
+            for (size_t i = 0; i < saida[u].size(); i++)
+            {
+                if (saida[u][i].vizinho == w)
+                {
+                    if (custo < saida[u][i].custo)
+                    {
+                        saida[u][i].custo = custo;
+                        saida[u][i].meio = meio;
+                        for (size_t j = 0; j < entrada[w].size(); j++)
+                        {
+                            if (entrada[w][j].vizinho == u)
+                            {
+                                entrada[w][j].custo = custo;
+                                entrada[w][j].meio = meio;
+                            }
+                        }
+                    }
+                    return;
+                }
+            }
+            Arco arco = {w, meio, custo};
+            saida[u].push_back(arco);
+            Arco inverso = {u, meio, custo};
+            entrada[w].push_back(inverso);
+        }
+
+        /**
+         * @brief Contrai (ou simula a contração de) v, criando os atalhos sem testemunha.
+         * @return Número de atalhos necessários.
+         */
+        int contrai(int v, bool simula)
+        {
+            int necessarios = 0;
+            for (size_t i = 0; i < entrada[v].size(); i++)
+            {
+                // Uma busca a partir de cada vizinho de entrada u cobre todos os alvos w de uma vez
+                int u = entrada[v][i].vizinho;
+                double custoUV = entrada[v][i].custo;
+                double maior = -1;
+                int alvos = 0;
+                rodada++;
+                for (size_t j = 0; j < saida[v].size(); j++)
+                {
+                    if (saida[v][j].vizinho != u)
+                    {
+                        maior = max(maior, custoUV + saida[v][j].custo);
+                        marcaAlvo[saida[v][j].vizinho] = rodada;
+                        alvos++;
+                    }
+                }
+                if (alvos == 0)
+                {
+                    continue;
+                }
+
+                buscaTestemunha(u, v, maior, simula ? LIMITE_SIMULACAO : LIMITE_TESTEMUNHA, alvos);
+                for (size_t j = 0; j < saida[v].size(); j++)
+                {
+                    int w = saida[v][j].vizinho;
+                    double custo = custoUV + saida[v][j].custo;
+                    if (w != u && distancia[w] > custo)
+                    {
+                        necessarios++;
+                        if (!simula)
+                        {
+                            insereArco(u, w, custo, v);
+                        }
+                    }
+                }
+                limpaBusca();
+            }
+            if (!simula)
+            {
+                atalhos += necessarios;
+            }
+            return necessarios;
+        }
+
+        /// Retira v do grafo restante (seus arcos já foram copiados para o índice).
+        void remove(int v)
+        {
+            for (size_t i = 0; i < saida[v].size(); i++)
+            {
+                retira(entrada[saida[v][i].vizinho], v);
+            }
+            for (size_t i = 0; i < entrada[v].size(); i++)
+            {
+                retira(saida[entrada[v][i].vizinho], v);
+            }
+            vector<Arco>().swap(saida[v]);
+            vector<Arco>().swap(entrada[v]);
+        }
+
+    private:
+        vector<double> distancia;    ///< Distâncias da busca de testemunha (infinito fora das posições tocadas).
+        vector<int> tocados;         ///< Vértices com distância escrita pela busca atual.
+        vector<Entrada> fila;        ///< Heap da busca de testemunha, reaproveitado entre as buscas.
+        vector<unsigned> marcaAlvo;  ///< Rodada em que o vértice foi marcado como alvo.
+        unsigned rodada;             ///< Rodada atual (uma por vizinho de entrada).
+
+        static void retira(vector<Arco> &arcos, int v)
+        {
+            for (size_t i = 0; i < arcos.size(); i++)
+            {
+                if (arcos[i].vizinho == v)
+                {
+                    arcos[i] = arcos.back();
+                    arcos.pop_back();
+                    return;
+                }
+            }
+        }
+
+        /// Dijkstra a partir de u sem passar por ignorado; para ao fechar os alvos, passar do limite de custo ou de vértices.
+        void buscaTestemunha(int u, int ignorado, double limite, int maxFechados, int alvos)
+        {
+            fila.clear();
+            distancia[u] = 0;
+            tocados.push_back(u);
+            fila.push_back(Entrada(0, u));
+            int fechados = 0;
+            while (!fila.empty() && fechados < maxFechados && alvos > 0)
+            {
+                pop_heap(fila.begin(), fila.end(), greater<Entrada>());
+                Entrada topo = fila.back();
+                fila.pop_back();
+                if (topo.first > distancia[topo.second])
+                {
+                    continue;
+                }
+                if (topo.first > limite)
+                {
+                    break;
+                }
+                fechados++;
+                if (marcaAlvo[topo.second] == rodada)
+                {
+                    alvos--;
+                }
+                const vector<Arco> &arcos = saida[topo.second];
+                for (size_t i = 0; i < arcos.size(); i++)
+                {
+                    int w = arcos[i].vizinho;
+                    double nova = topo.first + arcos[i].custo;
+                    if (w != ignorado && nova < distancia[w])
+                    {
+                        if (distancia[w] == numeric_limits<double>::infinity())
+                        {
+                            tocados.push_back(w);
+                        }
+                        distancia[w] = nova;
+                        fila.push_back(Entrada(nova, w));
+                        push_heap(fila.begin(), fila.end(), greater<Entrada>());
+                    }
+                }
+            }
+        }
+
+        void limpaBusca()
+        {
+            for (size_t i = 0; i < tocados.size(); i++)
+            {
+                distancia[tocados[i]] = numeric_limits<double>::infinity();
+            }
+            tocados.clear();
+        }
+    };
+
+    /// Grava um vetor no arquivo, sem cabeçalho.
+    template <typename T>
+    void gravaVetor(ofstream &saida, const vector<T> &valores)
+    {
+        if (!valores.empty())
+        {
+            saida.write(reinterpret_cast<const char *>(valores.data()), static_cast<streamsize>(valores.size() * sizeof(T)));
+        }
+    }
+
+    /// Lê n elementos do arquivo para o vetor.
+    template <typename T>
+    void leVetor(ifstream &entrada, vector<T> &valores, size_t n)
+    {
+        valores.resize(n);
+        if (n > 0)
+        {
+            entrada.read(reinterpret_cast<char *>(valores.data()), static_cast<streamsize>(n * sizeof(T)));
+        }
+    }
+}
+
+HierarquiaContracao::HierarquiaContracao()
+    : ordem(0), impressao(0), tempoConstrucao(0), numAtalhos(0), tamanhoNucleo(0), consulta(0), verticesVisitados(0)
+{
+}
+
+void HierarquiaContracao::limpa()
+{
+    ordem = 0;
+    impressao = 0;
+    numAtalhos = 0;
+    tamanhoNucleo = 0;
+    pesosNos.clear();
+    posicao.clear();
+    original.clear();
+    inicioSobe.assign(1, 0);
+    inicioDesce.assign(1, 0);
+    sobe.clear();
+    desce.clear();
+    reiniciaConsultas();
+}
+
+bool HierarquiaContracao::constroi(Grafo &grafo)
+{
+    chrono::steady_clock::time_point inicio = chrono::steady_clock::now();
+    limpa();
+
+    // Pesos exatos das listas de arestas (a matriz guarda pesos truncados)
+    VisaoCSR adjacencia = grafo.Grafo::visaoCSR();
+    int n = adjacencia.ordem;
+    vector<float> pesos(n, 0.0f);
+    for (int v = 0; v < n; v++)
+    {
+        if (!grafo.estaRemovido(v))
+        {
+            pesos[v] = grafo.getNoPeloId(v)->getPesoNo();
+        }
+    }
+
+    Contracao restante(n);
+    int arcosOriginais = 0;
+    for (int v = 0; v < n; v++)
+    {
+        for (int i = adjacencia.inicio[v]; i < adjacencia.inicio[v + 1]; i++)
+        {
+            int w = adjacencia.vizinhos[i];
+            double custo = static_cast<double>(adjacencia.pesos[i]) + pesos[w];
+            if (custo < 0)
+            {
+                cout << "Erro: a hierarquia de contração exige custos de arco não negativos (" << v << " -> " << w << ")." << endl;
+                return false;
+            }
+            if (w != v)
+            {
+                restante.insereArco(v, w, custo, -1);
+                arcosOriginais++;
+            }
+        }
+    }
+
+    // Ordem de contração: menor prioridade primeiro. A prioridade guardada pode estar desatualizada; ao sair da
+    // fila ela é recalculada e, se piorou, o vértice volta para a fila (atualização preguiçosa)
+    vector<int> contraidosVizinhos(n, 0);
+    vector<int> prioridade(n, 0);
+    vector<bool> contraido(n, false);
+    priority_queue<pair<int, int>, vector<pair<int, int>>, greater<pair<int, int>>> fila;
+    auto calculaPrioridade = [&](int v) {
+        int grau = static_cast<int>(restante.saida[v].size() + restante.entrada[v].size());
+        return restante.contrai(v, true) - grau + contraidosVizinhos[v];
+    };
+    for (int v = 0; v < n; v++)
+    {
+        if (!grafo.estaRemovido(v))
+        {
+            prioridade[v] = calculaPrioridade(v);
+            fila.push(make_pair(prioridade[v], v));
+        }
+    }
+
+    vector<int> ordemContracao;
+    vector<vector<Arco>> arcosSobe(n), arcosDesce(n);
+    while (!fila.empty() && restante.atalhos <= FATOR_ATALHOS * arcosOriginais)
+    {
+        pair<int, int> topo = fila.top();
+        fila.pop();
+        int v = topo.second;
+        if (contraido[v] || topo.first != prioridade[v])
+        {
+            continue;
+        }
+        prioridade[v] = calculaPrioridade(v);
+        if (!fila.empty() && prioridade[v] > fila.top().first)
+        {
+            fila.push(make_pair(prioridade[v], v));
+            continue;
+        }
+
+        restante.contrai(v, false);
+        contraido[v] = true;
+        ordemContracao.push_back(v);
+        arcosSobe[v] = restante.saida[v];
+        arcosDesce[v] = restante.entrada[v];
+        restante.remove(v);
+
+        // Os vizinhos ganham um vizinho contraído e podem ter ganhado atalhos: recalcula a prioridade deles
+        vector<int> vizinhos;
+        for (size_t i = 0; i < arcosSobe[v].size(); i++)
+        {
+            vizinhos.push_back(arcosSobe[v][i].vizinho);
+        }
+        for (size_t i = 0; i < arcosDesce[v].size(); i++)
+        {
+            vizinhos.push_back(arcosDesce[v][i].vizinho);
+        }
+        sort(vizinhos.begin(), vizinhos.end());
+        vizinhos.erase(unique(vizinhos.begin(), vizinhos.end()), vizinhos.end());
+        for (size_t i = 0; i < vizinhos.size(); i++)
+        {
+            int w = vizinhos[i];
+            contraidosVizinhos[w]++;
+            prioridade[w] = calculaPrioridade(w);
+            fila.push(make_pair(prioridade[w], w));
+        }
+    }
+
+    // Os vértices que sobraram formam o núcleo, acima de todos os contraídos, com todos os arcos entre si
+    for (int v = 0; v < n; v++)
+    {
+        if (!grafo.estaRemovido(v) && !contraido[v])
+        {
+            ordemContracao.push_back(v);
+            arcosSobe[v] = restante.saida[v];
+            arcosDesce[v] = restante.entrada[v];
+            tamanhoNucleo++;
+        }
+    }
+
+    // Índice final em CSR, com as posições em ordem decrescente de contração
+    int vivos = static_cast<int>(ordemContracao.size());
+    ordem = n;
+    pesosNos.swap(pesos);
+    posicao.assign(n, -1);
+    original.assign(vivos, -1);
+    for (int k = 0; k < vivos; k++)
+    {
+        original[vivos - 1 - k] = ordemContracao[k];
+        posicao[ordemContracao[k]] = vivos - 1 - k;
+    }
+    inicioSobe.assign(vivos + 1, 0);
+    inicioDesce.assign(vivos + 1, 0);
+    for (int p = 0; p < vivos; p++)
+    {
+        int v = original[p];
+        for (int lado = 0; lado < 2; lado++)
+        {
+            const vector<Arco> &arcos = lado == 0 ? arcosSobe[v] : arcosDesce[v];
+            vector<Arco> &destino = lado == 0 ? sobe : desce;
+            for (size_t i = 0; i < arcos.size(); i++)
+            {
+                Arco arco = {posicao[arcos[i].vizinho], arcos[i].meio == -1 ? -1 : posicao[arcos[i].meio], arcos[i].custo};
+                destino.push_back(arco);
+            }
+        }
+        inicioSobe[p + 1] = static_cast<int>(sobe.size());
+        inicioDesce[p + 1] = static_cast<int>(desce.size());
+    }
+    numAtalhos = restante.atalhos;
+    if (!grafo.getImpressaoDigital(impressao))
+    {
+        impressao = 0;
+    }
+    reiniciaConsultas();
+
+    tempoConstrucao = chrono::duration<double>(chrono::steady_clock::now() - inicio).count();
+    return true;
+}
+
+bool HierarquiaContracao::prepara(Grafo &grafo)
+{
+    unsigned long long impressaoGrafo;
+    string arquivo;
+    if (grafo.getImpressaoDigital(impressaoGrafo))
+    {
+        arquivo = CacheAnalise::caminhoArquivo(impressaoGrafo, ".ch");
+    }
+    if (!arquivo.empty() && ifstream(arquivo, ios::binary).is_open())
+    {
+        if (carrega(arquivo) && impressao == impressaoGrafo && ordem == grafo.getNumIndices())
+        {
+            return true;
+        }
+    }
+
+    if (!constroi(grafo))
+    {
+        return false;
+    }
+    if (!arquivo.empty())
+    {
+        salva(arquivo);
+    }
+    return true;
+}
+
+void HierarquiaContracao::reiniciaConsultas()
+{
+    Rotulo vazio = {numeric_limits<double>::infinity(), -1, -1, 0};
+    rotulos[0].assign(original.size(), vazio);
+    rotulos[1].assign(original.size(), vazio);
+    consulta = 0;
+}
+
+double HierarquiaContracao::distancia(int origem, int destino, vector<int> *caminho)
+{
+    const double infinito = numeric_limits<double>::infinity();
+    if (caminho != nullptr)
+    {
+        caminho->clear();
+    }
+    verticesVisitados = 0;
+    if (origem < 0 || origem >= ordem || destino < 0 || destino >= ordem || posicao[origem] == -1 || posicao[destino] == -1)
+    {
+        return infinito;
+    }
+    if (++consulta == 0)
+    {
+        // O contador deu a volta: rótulos antigos poderiam parecer da consulta atual
+        reiniciaConsultas();
+        consulta = 1;
+    }
+
+    // Lado 0 sobe a partir da origem pelos arcos de sobe; lado 1 sobe a partir do destino pelos arcos de desce
+    const int *inicios[2] = {inicioSobe.data(), inicioDesce.data()};
+    const Arco *arcos[2] = {sobe.data(), desce.data()};
+    Rotulo *estado[2] = {rotulos[0].data(), rotulos[1].data()};
+    FilaMinima filas[2];
+    int pontas[2] = {posicao[origem], posicao[destino]};
+    for (int lado = 0; lado < 2; lado++)
+    {
+        Rotulo &rotulo = estado[lado][pontas[lado]];
+        rotulo.distancia = 0;
+        rotulo.anterior = -1;
+        rotulo.marca = consulta;
+        filas[lado].push(Entrada(0, pontas[lado]));
+    }
+
+    double melhor = infinito;
+    int encontro = -1;
+    while (true)
+    {
+        // Cada lado para quando seu menor custo não pode mais melhorar o encontro
+        for (int lado = 0; lado < 2; lado++)
+        {
+            while (!filas[lado].empty() && filas[lado].top().first > estado[lado][filas[lado].top().second].distancia)
+            {
+                filas[lado].pop();
+            }
+            if (!filas[lado].empty() && filas[lado].top().first >= melhor)
+            {
+                FilaMinima().swap(filas[lado]);
+            }
+        }
+        if (filas[0].empty() && filas[1].empty())
+        {
+            break;
+        }
+        int lado = filas[1].empty() || (!filas[0].empty() && filas[0].top().first <= filas[1].top().first) ? 0 : 1;
+        int outro = 1 - lado;
+        Entrada topo = filas[lado].top();
+        filas[lado].pop();
+        int v = topo.second;
+        verticesVisitados++;
+
+        if (estado[outro][v].marca == consulta && topo.first + estado[outro][v].distancia < melhor)
+        {
+            melhor = topo.first + estado[outro][v].distancia;
+            encontro = v;
+        }
+
+        // Poda: se um vértice mais alto já chega a v mais barato pelo arco no outro sentido, a distância de v não
+        // é mínima e os arcos dele não precisam ser relaxados
+        bool podado = false;
+        for (int i = inicios[outro][v]; i < inicios[outro][v + 1] && !podado; i++)
+        {
+            const Rotulo &acima = estado[lado][arcos[outro][i].vizinho];
+            podado = acima.marca == consulta && acima.distancia + arcos[outro][i].custo < topo.first;
+        }
+        if (podado)
+        {
+            continue;
+        }
+
+        for (int i = inicios[lado][v]; i < inicios[lado][v + 1]; i++)
+        {
+            Rotulo &rotulo = estado[lado][arcos[lado][i].vizinho];
+            double nova = topo.first + arcos[lado][i].custo;
+            if (rotulo.marca != consulta || nova < rotulo.distancia)
+            {
+                rotulo.distancia = nova;
+                rotulo.anterior = v;
+                rotulo.arco = i;
+                rotulo.marca = consulta;
+                filas[lado].push(Entrada(nova, arcos[lado][i].vizinho));
+            }
+        }
+    }
+
+    if (encontro == -1)
+    {
+        return infinito;
+    }
+    if (caminho != nullptr)
+    {
+        // Origem até o encontro pela árvore da origem; encontro até o destino pela árvore do destino
+        vector<int> subida;
+        for (int p = encontro; p != pontas[0]; p = estado[0][p].anterior)
+        {
+            subida.push_back(p);
+        }
+        caminho->push_back(origem);
+        int atual = pontas[0];
+        for (size_t i = subida.size(); i-- > 0;)
+        {
+            int proximo = subida[i];
+            desempacota(atual, proximo, sobe[estado[0][proximo].arco].meio, *caminho);
+            atual = proximo;
+        }
+        while (atual != pontas[1])
+        {
+            int proximo = estado[1][atual].anterior;
+            desempacota(atual, proximo, desce[estado[1][atual].arco].meio, *caminho);
+            atual = proximo;
+        }
+    }
+    return melhor + pesosNos[origem];
+}
+
+int HierarquiaContracao::meioArco(int a, int b) const
+{
+    // O arco fica em sobe[a] se b está acima de a, senão em desce[b]
+    for (int i = inicioSobe[a]; i < inicioSobe[a + 1]; i++)
+    {
+        if (sobe[i].vizinho == b)
+        {
+            return sobe[i].meio;
+        }
+    }
+    for (int i = inicioDesce[b]; i < inicioDesce[b + 1]; i++)
+    {
+        if (desce[i].vizinho == a)
+        {
+            return desce[i].meio;
+        }
+    }
+    return -1;
+}
+
+void HierarquiaContracao::desempacota(int a, int b, int meio, vector<int> &caminho) const
+{
+    // Pilha explícita dos trechos ainda por desfazer; o do início do caminho fica no topo
+    vector<Trecho> pendentes;
+    Trecho inicial = {a, b, meio};
+    pendentes.push_back(inicial);
+    while (!pendentes.empty())
+    {
+        Trecho trecho = pendentes.back();
+        pendentes.pop_back();
+        if (trecho.meio == -1)
+        {
+            caminho.push_back(original[trecho.ate]);
+            continue;
+        }
+        Trecho segundo = {trecho.meio, trecho.ate, meioArco(trecho.meio, trecho.ate)};
+        Trecho primeiro = {trecho.de, trecho.meio, meioArco(trecho.de, trecho.meio)};
+        pendentes.push_back(segundo);
+        pendentes.push_back(primeiro);
+    }
+}
+
+size_t HierarquiaContracao::getTamanho() const
+{
+    return pesosNos.size() * sizeof(float) + posicao.size() * sizeof(int) +
+           (inicioSobe.size() + inicioDesce.size()) * sizeof(int) + (sobe.size() + desce.size()) * sizeof(Arco);
+}
+
+bool HierarquiaContracao::salva(const string &arquivo) const
+{
+    ofstream saida(arquivo, ios::binary | ios::trunc);
+    if (!saida.is_open())
+    {
+        cerr << "Erro: não foi possível gravar a hierarquia de contração em " << arquivo << endl;
+        return false;
+    }
+
+    char bruto[TAMANHO_CABECALHO] = {};
+    Cabecalho cabecalho;
+    memcpy(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA));
+    cabecalho.impressao = impressao;
+    cabecalho.ordem = ordem;
+    cabecalho.vivos = static_cast<int>(original.size());
+    cabecalho.numSobe = static_cast<int>(sobe.size());
+    cabecalho.numDesce = static_cast<int>(desce.size());
+    cabecalho.numAtalhos = numAtalhos;
+    cabecalho.tamanhoNucleo = tamanhoNucleo;
+    memcpy(bruto, &cabecalho, sizeof(cabecalho));
+    saida.write(bruto, TAMANHO_CABECALHO);
+    gravaVetor(saida, pesosNos);
+    gravaVetor(saida, posicao);
+    gravaVetor(saida, inicioSobe);
+    gravaVetor(saida, inicioDesce);
+    gravaVetor(saida, sobe);
+    gravaVetor(saida, desce);
+    return static_cast<bool>(saida);
+}
+
+bool HierarquiaContracao::carrega(const string &arquivo)
+{
+    ifstream entrada(arquivo, ios::binary);
+    if (!entrada.is_open())
+    {
+        cerr << "Erro: não foi possível abrir a hierarquia de contração " << arquivo << endl;
+        return false;
+    }
+
+    char bruto[TAMANHO_CABECALHO];
+    Cabecalho cabecalho;
+    entrada.read(bruto, TAMANHO_CABECALHO);
+    memcpy(&cabecalho, bruto, sizeof(cabecalho));
+    entrada.seekg(0, ios::end);
+    size_t tamanhoArquivo = static_cast<size_t>(entrada.tellg());
+    size_t n = static_cast<size_t>(cabecalho.ordem);
+    size_t vivos = static_cast<size_t>(cabecalho.vivos);
+    if (!entrada || memcmp(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 || cabecalho.ordem < 0 ||
+        cabecalho.vivos < 0 || vivos > n || cabecalho.numSobe < 0 || cabecalho.numDesce < 0 ||
+        tamanhoArquivo != TAMANHO_CABECALHO + n * (sizeof(float) + sizeof(int)) + 2 * (vivos + 1) * sizeof(int) +
+                              (static_cast<size_t>(cabecalho.numSobe) + cabecalho.numDesce) * sizeof(Arco))
+    {
+        cerr << "Erro: " << arquivo << " não é uma hierarquia de contração válida" << endl;
+        return false;
+    }
+
+    entrada.clear();
+    entrada.seekg(TAMANHO_CABECALHO, ios::beg);
+    leVetor(entrada, pesosNos, n);
+    leVetor(entrada, posicao, n);
+    leVetor(entrada, inicioSobe, vivos + 1);
+    leVetor(entrada, inicioDesce, vivos + 1);
+    leVetor(entrada, sobe, static_cast<size_t>(cabecalho.numSobe));
+    leVetor(entrada, desce, static_cast<size_t>(cabecalho.numDesce));
+
+    // Confere a permutação, os deslocamentos e os índices dos arcos antes de usar o conteúdo
+    bool valido = static_cast<bool>(entrada) && inicioSobe[0] == 0 && inicioDesce[0] == 0 &&
+                  inicioSobe[vivos] == cabecalho.numSobe && inicioDesce[vivos] == cabecalho.numDesce;
+    original.assign(vivos, -1);
+    for (size_t v = 0; valido && v < n; v++)
+    {
+        int p = posicao[v];
+        valido = p == -1 || (p >= 0 && static_cast<size_t>(p) < vivos && original[p] == -1);
+        if (valido && p != -1)
+        {
+            original[p] = static_cast<int>(v);
+        }
+    }
+    for (size_t p = 0; valido && p < vivos; p++)
+    {
+        valido = original[p] != -1 && inicioSobe[p] <= inicioSobe[p + 1] && inicioDesce[p] <= inicioDesce[p + 1];
+    }
+    for (size_t i = 0; valido && i < sobe.size() + desce.size(); i++)
+    {
+        const Arco &arco = i < sobe.size() ? sobe[i] : desce[i - sobe.size()];
+        valido = arco.vizinho >= 0 && static_cast<size_t>(arco.vizinho) < vivos && arco.meio >= -1 &&
+                 (arco.meio == -1 || static_cast<size_t>(arco.meio) < vivos);
+    }
+    if (!valido)
+    {
+        cerr << "Erro: " << arquivo << " não é uma hierarquia de contração válida" << endl;
+        limpa();
+        return false;
+    }
+
+    ordem = cabecalho.ordem;
+    impressao = cabecalho.impressao;
+    numAtalhos = cabecalho.numAtalhos;
+    tamanhoNucleo = cabecalho.tamanhoNucleo;
+    tempoConstrucao = 0;
+    reiniciaConsultas();
+    return true;
+}
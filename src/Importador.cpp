@@ -0,0 +1,714 @@
+/**
+ * @file Importador.cpp
+ * @brief Implementação dos leitores de arquivos de grafo (nativo, lista de arestas, DIMACS, METIS e MatrixMarket).
+ */
+
+#include "../include/Importador.h"
+#include <fstream>
+#include <iostream>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+
+using namespace std;
+
+/**
+ * @brief Cursor simples sobre o conteúdo do arquivo já carregado em memória.
+ *
+ * A leitura é feita linha a linha, sem streams formatados, para que arquivos grandes
+ * sejam interpretados em uma única passada.
+ */
+struct Cursor
+{
+    const char *p;   ///< Posição atual.
+    const char *fim; ///< Fim do conteúdo.
+};
+
+static void pulaEspacos(Cursor &c)
+{
+    while (c.p < c.fim && (*c.p == ' ' || *c.p == '\t' || *c.p == '\r'))
+    {
+        c.p++;
+    }
+}
+
+static bool fimDeLinha(Cursor &c)
+{
+    pulaEspacos(c);
+    return c.p >= c.fim || *c.p == '\n';
+}
+
+static void proximaLinha(Cursor &c)
+{
+    while (c.p < c.fim && *c.p != '\n')
+    {
+        c.p++;
+    }
+    if (c.p < c.fim)
+    {
+        c.p++;
+    }
+}
+
+static bool leInteiro(Cursor &c, long long &valor)
+{
+    pulaEspacos(c);
+    bool negativo = false;
+    if (c.p < c.fim && (*c.p == '-' || *c.p == '+'))
+    {
+        negativo = (*c.p == '-');
+        c.p++;
+    }
+    if (c.p >= c.fim || *c.p < '0' || *c.p > '9')
+    {
+        return false;
+    }
+    long long v = 0;
+    while (c.p < c.fim && *c.p >= '0' && *c.p <= '9')
+    {
+        v = v * 10 + (*c.p - '0');
+        c.p++;
+    }
+    // Aceita valores como "3.0" em campos inteiros, descartando a parte fracionária
+    if (c.p < c.fim && *c.p == '.')
+    {
+        c.p++;
+        while (c.p < c.fim && *c.p >= '0' && *c.p <= '9')
+        {
+            c.p++;
+        }
+    }
+    valor = negativo ? -v : v;
+    return true;
+}
+
+static bool leReal(Cursor &c, float &valor)
+{
+    pulaEspacos(c);
+    if (c.p >= c.fim || *c.p == '\n')
+    {
+        return false;
+    }
+    char *final = nullptr;
+    valor = strtof(c.p, &final);
+    if (final == c.p)
+    {
+        return false;
+    }
+    c.p = final;
+    return true;
+}
+
+/// Pula linhas vazias e linhas de comentário iniciadas por algum dos caracteres indicados.
+static void pulaComentarios(Cursor &c, const char *marcadores)
+{
+    while (c.p < c.fim)
+    {
+        pulaEspacos(c);
+        if (c.p < c.fim && (*c.p == '\n' || strchr(marcadores, *c.p) != nullptr))
+        {
+            proximaLinha(c);
+            continue;
+        }
+        break;
+    }
+}
+
+static bool terminaCom(const string &texto, const string &sufixo)
+{
+    if (texto.size() < sufixo.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < sufixo.size(); i++)
+    {
+        char a = texto[texto.size() - sufixo.size() + i];
+        if (a >= 'A' && a <= 'Z')
+        {
+            a = a - 'A' + 'a';
+        }
+        if (a != sufixo[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+const char *Importador::nomeFormato(FormatoGrafo formato)
+{
+    switch (formato)
+    {
+    case FormatoGrafo::Nativo:
+        return "nativo";
+    case FormatoGrafo::ListaArestas:
+        return "lista de arestas";
+    case FormatoGrafo::Dimacs:
+        return "DIMACS";
+    case FormatoGrafo::Metis:
+        return "METIS";
+    case FormatoGrafo::MatrixMarket:
+        return "MatrixMarket";
+    case FormatoGrafo::Configuracao:
+        return "configuração";
+    default:
+        return "desconhecido";
+    }
+}
+
+FormatoGrafo Importador::detectaFormato(const string &arquivo, const string &conteudo)
+{
+    // Primeiro pela extensão
+    if (terminaCom(arquivo, ".clq") || terminaCom(arquivo, ".col") || terminaCom(arquivo, ".dimacs") ||
+        terminaCom(arquivo, ".gr"))
+    {
+        return FormatoGrafo::Dimacs;
+    }
+    if (terminaCom(arquivo, ".graph") || terminaCom(arquivo, ".metis"))
+    {
+        return FormatoGrafo::Metis;
+    }
+    if (terminaCom(arquivo, ".mtx"))
+    {
+        return FormatoGrafo::MatrixMarket;
+    }
+    if (terminaCom(arquivo, ".edges") || terminaCom(arquivo, ".el"))
+    {
+        return FormatoGrafo::ListaArestas;
+    }
+
+    // Depois pelo cabeçalho
+    if (conteudo.compare(0, 14, "%%MatrixMarket") == 0)
+    {
+        return FormatoGrafo::MatrixMarket;
+    }
+
+    Cursor c = {conteudo.data(), conteudo.data() + conteudo.size()};
+    pulaComentarios(c, "#%");
+    if (conteudo.compare(c.p - conteudo.data(), 6, "matriz") == 0 ||
+        conteudo.compare(c.p - conteudo.data(), 5, "lista") == 0)
+    {
+        return FormatoGrafo::Configuracao;
+    }
+    if (c.p < c.fim && (*c.p == 'c' || *c.p == 'p'))
+    {
+        return FormatoGrafo::Dimacs;
+    }
+
+    // Cabeçalho nativo: quatro inteiros, sendo os três últimos flags 0/1
+    long long campos[5];
+    int numCampos = 0;
+    while (numCampos < 5 && !fimDeLinha(c) && leInteiro(c, campos[numCampos]))
+    {
+        numCampos++;
+    }
+    if (numCampos == 4 && fimDeLinha(c) && campos[0] >= 0)
+    {
+        bool flags = true;
+        for (int i = 1; i < 4; i++)
+        {
+            flags = flags && (campos[i] == 0 || campos[i] == 1);
+        }
+        if (flags)
+        {
+            return FormatoGrafo::Nativo;
+        }
+    }
+    if (numCampos == 2 || numCampos == 3)
+    {
+        return FormatoGrafo::ListaArestas;
+    }
+    return FormatoGrafo::Desconhecido;
+}
+
+bool Importador::leArquivo(const string &arquivo, string &conteudo)
+{
+    ifstream file(arquivo, ios::in | ios::binary);
+    if (!file.is_open())
+    {
+        cerr << "Erro ao abrir o arquivo " << arquivo << endl;
+        return false;
+    }
+    file.seekg(0, ios::end);
+    streamoff tamanho = file.tellg();
+    file.seekg(0, ios::beg);
+    conteudo.resize(tamanho > 0 ? static_cast<size_t>(tamanho) : 0);
+    if (tamanho > 0)
+    {
+        file.read(&conteudo[0], tamanho);
+    }
+    file.close();
+    return true;
+}
+
+bool Importador::carrega(const string &arquivo, DadosGrafo &dados)
+{
+    string conteudo;
+    if (!leArquivo(arquivo, conteudo))
+    {
+        return false;
+    }
+
+    FormatoGrafo formato = detectaFormato(arquivo, conteudo);
+    if (formato == FormatoGrafo::Desconhecido)
+    {
+        cerr << "Formato de arquivo não reconhecido: " << arquivo << endl;
+        return false;
+    }
+    if (!interpreta(conteudo, formato, dados))
+    {
+        cerr << "Erro ao interpretar o arquivo " << arquivo << " (formato " << nomeFormato(formato) << ")" << endl;
+        return false;
+    }
+    return true;
+}
+
+bool Importador::carrega(const string &arquivo, FormatoGrafo formato, DadosGrafo &dados)
+{
+    string conteudo;
+    if (!leArquivo(arquivo, conteudo))
+    {
+        return false;
+    }
+    return interpreta(conteudo, formato, dados);
+}
+
+bool Importador::interpreta(const string &conteudo, FormatoGrafo formato, DadosGrafo &dados)
+{
+    dados = DadosGrafo();
+
+    switch (formato)
+    {
+    case FormatoGrafo::Nativo:
+        return leNativo(conteudo, dados);
+    case FormatoGrafo::ListaArestas:
+        return leListaArestas(conteudo, dados);
+    case FormatoGrafo::Dimacs:
+        return leDimacs(conteudo, dados);
+    case FormatoGrafo::Metis:
+        return leMetis(conteudo, dados);
+    case FormatoGrafo::MatrixMarket:
+        return leMatrixMarket(conteudo, dados);
+    case FormatoGrafo::Configuracao:
+        return leConfiguracao(conteudo, dados);
+    default:
+        return false;
+    }
+}
+
+/// Adiciona uma aresta com IDs baseados em 0, ignorando (e contando) arestas fora do intervalo.
+static void adicionaAresta(DadosGrafo &dados, long long origem, long long destino, float peso, int &invalidas)
+{
+    if (origem < 0 || origem >= dados.ordem || destino < 0 || destino >= dados.ordem)
+    {
+        invalidas++;
+        return;
+    }
+    ArestaLida aresta = {static_cast<int>(origem), static_cast<int>(destino), peso};
+    dados.arestas.push_back(aresta);
+}
+
+static void avisaInvalidas(int invalidas)
+{
+    if (invalidas > 0)
+    {
+        cerr << "Aviso: " << invalidas << " aresta(s) com vértices fora do intervalo foram ignoradas." << endl;
+    }
+}
+
+bool Importador::leNativo(const string &conteudo, DadosGrafo &dados)
+{
+    Cursor c = {conteudo.data(), conteudo.data() + conteudo.size()};
+    pulaComentarios(c, "#%");
+
+    // Os campos do cabeçalho podem estar em uma linha só ou um por linha (arquivos de configuração)
+    long long cabecalho[4];
+    for (int i = 0; i < 4; i++)
+    {
+        pulaComentarios(c, "#%");
+        if (!leInteiro(c, cabecalho[i]))
+        {
+            return false;
+        }
+    }
+    long long numNos = cabecalho[0];
+    long long direcionado = cabecalho[1];
+    long long ponderadoVertices = cabecalho[2];
+    long long ponderadoArestas = cabecalho[3];
+    if (numNos < 0)
+    {
+        return false;
+    }
+
+    dados.ordem = static_cast<int>(numNos);
+    dados.direcionado = direcionado != 0;
+    dados.ponderadoVertices = ponderadoVertices != 0;
+    dados.ponderadoArestas = ponderadoArestas != 0;
+
+    if (dados.ponderadoVertices)
+    {
+        dados.pesosVertices.resize(dados.ordem, 0.0f);
+        for (int i = 0; i < dados.ordem; i++)
+        {
+            // Os pesos podem ocupar uma ou várias linhas
+            while (c.p < c.fim && fimDeLinha(c))
+            {
+                proximaLinha(c);
+            }
+            if (!leReal(c, dados.pesosVertices[i]))
+            {
+                return false;
+            }
+        }
+    }
+    proximaLinha(c);
+
+    // Cada linha de aresta é "origem destino" ou "origem destino peso" (IDs baseados em 1)
+    int invalidas = 0;
+    while (c.p < c.fim)
+    {
+        long long origem, destino;
+        if (fimDeLinha(c) || !leInteiro(c, origem) || !leInteiro(c, destino))
+        {
+            proximaLinha(c);
+            continue;
+        }
+        float peso = 1.0f;
+        if (!fimDeLinha(c))
+        {
+            leReal(c, peso);
+        }
+        adicionaAresta(dados, origem - 1, destino - 1, peso, invalidas);
+        proximaLinha(c);
+    }
+    avisaInvalidas(invalidas);
+    return true;
+}
+
+bool Importador::leListaArestas(const string &conteudo, DadosGrafo &dados)
+{
+    Cursor c = {conteudo.data(), conteudo.data() + conteudo.size()};
+
+    struct Entrada
+    {
+        long long origem, destino;
+        float peso;
+    };
+    vector<Entrada> entradas;
+    long long menorId = LLONG_MAX, maiorId = LLONG_MIN;
+    bool temPeso = false;
+
+    while (c.p < c.fim)
+    {
+        pulaComentarios(c, "#%");
+        long long origem, destino;
+        if (c.p >= c.fim || !leInteiro(c, origem) || !leInteiro(c, destino))
+        {
+            proximaLinha(c);
+            continue;
+        }
+        float peso = 1.0f;
+        if (!fimDeLinha(c) && leReal(c, peso))
+        {
+            temPeso = true;
+        }
+        Entrada e = {origem, destino, peso};
+        entradas.push_back(e);
+        long long menor = origem < destino ? origem : destino;
+        long long maior = origem < destino ? destino : origem;
+        if (menor < menorId)
+            menorId = menor;
+        if (maior > maiorId)
+            maiorId = maior;
+        proximaLinha(c);
+    }
+
+    dados.direcionado = false;
+    dados.ponderadoArestas = temPeso;
+    dados.arestas.reserve(entradas.size());
+
+    // IDs densos baseados em 1 (ou em 0, se o arquivo usa o vértice 0) são usados diretamente como índices.
+    // IDs negativos ou esparsos demais (intervalo maior que o dobro do número de IDs lidos) passam pelo mapa de IDs,
+    // e os índices seguem a ordem em que os IDs aparecem no arquivo.
+    long long base = (menorId == 0) ? 0 : 1;
+    bool denso = !entradas.empty() && menorId >= 0 && maiorId - base < 2 * static_cast<long long>(entradas.size()) + 1;
+    if (entradas.empty() || denso)
+    {
+        dados.ordem = entradas.empty() ? 0 : static_cast<int>(maiorId - base + 1);
+        dados.ids.configuraIdentidade(dados.ordem, base);
+        int invalidas = 0;
+        for (size_t i = 0; i < entradas.size(); i++)
+        {
+            if (entradas[i].origem != entradas[i].destino)
+            {
+                adicionaAresta(dados, entradas[i].origem - base, entradas[i].destino - base, entradas[i].peso, invalidas);
+            }
+        }
+        avisaInvalidas(invalidas);
+        return true;
+    }
+
+    dados.ids = MapaIds();
+    dados.ids.reserva(static_cast<int>(entradas.size()));
+    for (size_t i = 0; i < entradas.size(); i++)
+    {
+        int origem = dados.ids.insere(entradas[i].origem);
+        int destino = dados.ids.insere(entradas[i].destino);
+        if (origem != destino)
+        {
+            ArestaLida aresta = {origem, destino, entradas[i].peso};
+            dados.arestas.push_back(aresta);
+        }
+    }
+    dados.ordem = dados.ids.tamanho();
+    return true;
+}
+
+bool Importador::leDimacs(const string &conteudo, DadosGrafo &dados)
+{
+    Cursor c = {conteudo.data(), conteudo.data() + conteudo.size()};
+    bool temCabecalho = false;
+    int invalidas = 0;
+
+    while (c.p < c.fim)
+    {
+        pulaEspacos(c);
+        if (c.p >= c.fim)
+        {
+            break;
+        }
+        char tipo = *c.p;
+        if (tipo == 'p')
+        {
+            // p <formato> <n> <m>; "sp" indica arcos direcionados
+            c.p++;
+            pulaEspacos(c);
+            const char *inicioFormato = c.p;
+            while (c.p < c.fim && *c.p != ' ' && *c.p != '\t' && *c.p != '\n')
+            {
+                c.p++;
+            }
+            string formato(inicioFormato, c.p);
+            long long n, m;
+            if (!leInteiro(c, n) || !leInteiro(c, m) || n < 0)
+            {
+                return false;
+            }
+            dados.ordem = static_cast<int>(n);
+            dados.direcionado = (formato == "sp");
+            dados.arestas.reserve(static_cast<size_t>(m));
+            temCabecalho = true;
+        }
+        else if ((tipo == 'e' || tipo == 'a') && temCabecalho)
+        {
+            c.p++;
+            long long origem, destino;
+            if (leInteiro(c, origem) && leInteiro(c, destino) && origem != destino)
+            {
+                float peso = 1.0f;
+                if (!fimDeLinha(c) && leReal(c, peso))
+                {
+                    dados.ponderadoArestas = true;
+                }
+                adicionaAresta(dados, origem - 1, destino - 1, peso, invalidas);
+            }
+        }
+        else if (tipo == 'n' && temCabecalho)
+        {
+            // n <vértice> <peso>: peso de vértice (instâncias ponderadas)
+            c.p++;
+            long long vertice;
+            float peso;
+            if (leInteiro(c, vertice) && leReal(c, peso) && vertice >= 1 && vertice <= dados.ordem)
+            {
+                if (!dados.ponderadoVertices)
+                {
+                    dados.ponderadoVertices = true;
+                    dados.pesosVertices.assign(dados.ordem, 0.0f);
+                }
+                dados.pesosVertices[vertice - 1] = peso;
+            }
+        }
+        proximaLinha(c);
+    }
+
+    avisaInvalidas(invalidas);
+    return temCabecalho;
+}
+
+bool Importador::leMetis(const string &conteudo, DadosGrafo &dados)
+{
+    Cursor c = {conteudo.data(), conteudo.data() + conteudo.size()};
+    pulaComentarios(c, "%");
+
+    long long n, m, fmt = 0, ncon = 1;
+    if (!leInteiro(c, n) || !leInteiro(c, m) || n < 0)
+    {
+        return false;
+    }
+    if (!fimDeLinha(c))
+    {
+        leInteiro(c, fmt);
+    }
+    if (!fimDeLinha(c))
+    {
+        leInteiro(c, ncon);
+    }
+    proximaLinha(c);
+
+    // fmt = "abc": a = tamanhos de vértice, b = pesos de vértice, c = pesos de aresta
+    bool pesosArestas = (fmt % 10) != 0;
+    bool pesosVertices = ((fmt / 10) % 10) != 0;
+    bool tamanhos = ((fmt / 100) % 10) != 0;
+
+    dados.ordem = static_cast<int>(n);
+    dados.direcionado = false;
+    dados.ponderadoVertices = pesosVertices;
+    dados.ponderadoArestas = pesosArestas;
+    if (pesosVertices)
+    {
+        dados.pesosVertices.assign(dados.ordem, 0.0f);
+    }
+    dados.arestas.reserve(static_cast<size_t>(m));
+
+    int invalidas = 0;
+    for (long long u = 0; u < n && c.p < c.fim; u++)
+    {
+        // Linhas de comentário não contam como vértices; linhas vazias sim
+        pulaEspacos(c);
+        while (c.p < c.fim && *c.p == '%')
+        {
+            proximaLinha(c);
+            pulaEspacos(c);
+        }
+
+        long long valor;
+        if (tamanhos)
+        {
+            leInteiro(c, valor);
+        }
+        if (pesosVertices)
+        {
+            for (long long k = 0; k < ncon; k++)
+            {
+                float peso;
+                if (leReal(c, peso) && k == 0)
+                {
+                    dados.pesosVertices[u] = peso;
+                }
+            }
+        }
+        while (!fimDeLinha(c))
+        {
+            long long v;
+            if (!leInteiro(c, v))
+            {
+                break;
+            }
+            float peso = 1.0f;
+            if (pesosArestas)
+            {
+                leReal(c, peso);
+            }
+            // Cada aresta aparece nas listas dos dois extremos; mantém apenas uma cópia
+            if (u < v - 1)
+            {
+                adicionaAresta(dados, u, v - 1, peso, invalidas);
+            }
+        }
+        proximaLinha(c);
+    }
+
+    avisaInvalidas(invalidas);
+    return true;
+}
+
+bool Importador::leMatrixMarket(const string &conteudo, DadosGrafo &dados)
+{
+    Cursor c = {conteudo.data(), conteudo.data() + conteudo.size()};
+
+    // %%MatrixMarket matrix coordinate <campo> <simetria>
+    const char *inicio = c.p;
+    proximaLinha(c);
+    string banner(inicio, c.p);
+    for (size_t i = 0; i < banner.size(); i++)
+    {
+        if (banner[i] >= 'A' && banner[i] <= 'Z')
+        {
+            banner[i] = banner[i] - 'A' + 'a';
+        }
+    }
+    if (banner.find("coordinate") == string::npos)
+    {
+        cerr << "Apenas matrizes MatrixMarket no formato coordenado são suportadas." << endl;
+        return false;
+    }
+    if (banner.find("complex") != string::npos)
+    {
+        cerr << "Matrizes MatrixMarket complexas não são suportadas." << endl;
+        return false;
+    }
+    bool padrao = banner.find("pattern") != string::npos;
+    bool geral = banner.find("general") != string::npos;
+
+    pulaComentarios(c, "%");
+    long long linhas, colunas, naoNulos;
+    if (!leInteiro(c, linhas) || !leInteiro(c, colunas) || !leInteiro(c, naoNulos))
+    {
+        return false;
+    }
+    proximaLinha(c);
+
+    dados.ordem = static_cast<int>(linhas > colunas ? linhas : colunas);
+    dados.direcionado = geral;
+    dados.ponderadoArestas = !padrao;
+    dados.arestas.reserve(static_cast<size_t>(naoNulos));
+
+    int invalidas = 0;
+    for (long long k = 0; k < naoNulos && c.p < c.fim; k++)
+    {
+        pulaComentarios(c, "%");
+        long long i, j;
+        if (!leInteiro(c, i) || !leInteiro(c, j))
+        {
+            proximaLinha(c);
+            continue;
+        }
+        float peso = 1.0f;
+        if (!padrao)
+        {
+            leReal(c, peso);
+        }
+        // A diagonal não representa arestas do grafo
+        if (i != j)
+        {
+            adicionaAresta(dados, i - 1, j - 1, peso, invalidas);
+        }
+        proximaLinha(c);
+    }
+
+    avisaInvalidas(invalidas);
+    return true;
+}
+
+bool Importador::leConfiguracao(const string &conteudo, DadosGrafo &dados)
+{
+    // Primeira palavra: estrutura ("matriz" ou "lista"); o restante segue o formato nativo
+    size_t inicio = conteudo.find_first_not_of(" \t\r\n");
+    if (inicio == string::npos)
+    {
+        return false;
+    }
+    size_t fim = conteudo.find_first_of(" \t\r\n", inicio);
+    if (fim == string::npos)
+    {
+        fim = conteudo.size();
+    }
+    string estrutura = conteudo.substr(inicio, fim - inicio);
+    if (!leNativo(conteudo.substr(fim), dados))
+    {
+        return false;
+    }
+    dados.estrutura = estrutura;
+    return true;
+}
@@ -5,25 +5,47 @@
 
 #include "../include/Lista.h"
 #include <iostream>
+#include <new>
 
 using namespace std;
 
-Lista::Lista() : cabeca(nullptr), tamanho(0) {}
+Lista::Lista() : cabeca(nullptr), tamanho(0), arena(nullptr) {}
 
 Lista::~Lista()
+{
+    limpa();
+}
+
+void Lista::limpa()
 {
     No *atual = cabeca;
     while (atual != nullptr)
     {
         No *prox = atual->getProxNo();
-        delete atual;
+        liberaNo(atual);
         atual = prox;
     }
+    cabeca = nullptr;
+    tamanho = 0;
+}
+
+void Lista::preenche(const int *ids, const float *pesos, int quantidade)
+{
+    limpa();
+
+    // Encadeia de trás para frente para que a lista fique na ordem do array
+    for (int i = quantidade - 1; i >= 0; i--)
+    {
+        No *novoNo = criaNo(ids[i], pesos != nullptr ? pesos[i] : 0.0f);
+        novoNo->setProxNo(cabeca);
+        cabeca = novoNo;
+    }
+    tamanho = quantidade;
 }
 
 void Lista::adicionar(int idNo, float pesoNo)
 {
-    No *novoNo = new No(idNo, pesoNo);
+    No *novoNo = criaNo(idNo, pesoNo);
     novoNo->setProxNo(cabeca);
     cabeca = novoNo;
     tamanho++;
@@ -50,7 +72,7 @@ void Lista::remover(int idNo)
         {
             anterior->setProxNo(atual->getProxNo());
         }
-        delete atual;
+        liberaNo(atual);
         tamanho--;
     }
 }
@@ -69,6 +91,11 @@ bool Lista::contem(int idNo) const
     return false;
 }
 
+No *Lista::getPrimeiro() const
+{
+    return cabeca;
+}
+
 int Lista::getTamanho() const
 {
     return tamanho;
@@ -88,4 +115,43 @@ No* Lista::getElemento(int indice) const
         atual = atual->getProxNo();
     }
     return atual;
-}
\ No newline at end of file
+}
+
+void Lista::troca(Lista &outra)
+{
+    No *cabecaOutra = outra.cabeca;
+    int tamanhoOutra = outra.tamanho;
+    outra.cabeca = cabeca;
+    outra.tamanho = tamanho;
+    cabeca = cabecaOutra;
+    tamanho = tamanhoOutra;
+}
+
+void Lista::usaArena(Arena *arena)
+{
+    this->arena = arena;
+}
+
+void Lista::solta()
+{
+    cabeca = nullptr;
+    tamanho = 0;
+}
+
+No *Lista::criaNo(int idNo, float pesoNo)
+{
+    return arena != nullptr ? new (arena->aloca()) No(idNo, pesoNo) : new No(idNo, pesoNo);
+}
+
+void Lista::liberaNo(No *no)
+{
+    if (arena != nullptr)
+    {
+        no->~No();
+        arena->libera(no);
+    }
+    else
+    {
+        delete no;
+    }
+}
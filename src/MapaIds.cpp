@@ -0,0 +1,181 @@
+/**
+ * @file MapaIds.cpp
+ * @brief Implementação do mapeamento entre IDs externos e índices densos.
+ */
+
+#include "../include/MapaIds.h"
+
+using namespace std;
+
+MapaIds::MapaIds() : quantidade(0), base(1), maiorId(0) {}
+
+void MapaIds::configuraIdentidade(int quantidade, long long base)
+{
+    this->quantidade = quantidade;
+    this->base = base;
+    maiorId = base + quantidade - 1;
+    externos.clear();
+    chaves.clear();
+    valores.clear();
+}
+
+void MapaIds::reserva(int quantidade)
+{
+    externos.reserve(quantidade);
+    // No modo identidade não há tabela; fator de carga máximo de 1/2 no modo explícito
+    if (!ehIdentidade() && static_cast<size_t>(quantidade) * 2 > valores.size())
+    {
+        redimensiona(quantidade * 2);
+    }
+}
+
+int MapaIds::insere(long long externo)
+{
+    int existente = indice(externo);
+    if (existente != -1)
+    {
+        return existente;
+    }
+
+    if (ehIdentidade())
+    {
+        if (quantidade == 0)
+        {
+            base = externo;
+        }
+        if (externo == base + quantidade)
+        {
+            maiorId = externo;
+            return quantidade++;
+        }
+        materializa();
+    }
+
+    if (static_cast<size_t>(quantidade + 1) * 2 > valores.size())
+    {
+        redimensiona((quantidade + 1) * 2);
+    }
+    externos.push_back(externo);
+    insereNaTabela(externo, quantidade);
+    if (externo > maiorId)
+    {
+        maiorId = externo;
+    }
+    return quantidade++;
+}
+
+int MapaIds::indice(long long externo) const
+{
+    if (ehIdentidade())
+    {
+        long long i = externo - base;
+        return (i >= 0 && i < quantidade) ? static_cast<int>(i) : -1;
+    }
+
+    size_t mascara = valores.size() - 1;
+    for (size_t p = posicao(externo);; p = (p + 1) & mascara)
+    {
+        if (valores[p] == -1)
+        {
+            return -1;
+        }
+        if (chaves[p] == externo)
+        {
+            return valores[p];
+        }
+    }
+}
+
+long long MapaIds::externo(int indice) const
+{
+    return ehIdentidade() ? base + indice : externos[indice];
+}
+
+long long MapaIds::proximoLivre() const
+{
+    return quantidade == 0 ? base : maiorId + 1;
+}
+
+void MapaIds::compacta(const vector<int> &novoIndice, int novaQuantidade)
+{
+    // Identidade em que só o fim foi removido continua identidade
+    if (ehIdentidade() && (novaQuantidade == 0 || novoIndice[novaQuantidade - 1] == novaQuantidade - 1))
+    {
+        quantidade = novaQuantidade;
+        return;
+    }
+    if (ehIdentidade())
+    {
+        materializa();
+    }
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (novoIndice[i] != -1)
+        {
+            externos[novoIndice[i]] = externos[i];
+        }
+    }
+    externos.resize(novaQuantidade);
+    quantidade = novaQuantidade;
+    redimensiona(quantidade * 2);
+}
+
+int MapaIds::tamanho() const
+{
+    return quantidade;
+}
+
+bool MapaIds::ehIdentidade() const
+{
+    return valores.empty();
+}
+
+void MapaIds::materializa()
+{
+    externos.resize(quantidade);
+    for (int i = 0; i < quantidade; i++)
+    {
+        externos[i] = base + i;
+    }
+    redimensiona(quantidade * 2 > 16 ? quantidade * 2 : 16);
+}
+
+void MapaIds::redimensiona(int capacidade)
+{
+    size_t tamanhoTabela = 16;
+    while (tamanhoTabela < static_cast<size_t>(capacidade))
+    {
+        tamanhoTabela <<= 1;
+    }
+    chaves.assign(tamanhoTabela, 0);
+    valores.assign(tamanhoTabela, -1);
+    for (int i = 0; i < static_cast<int>(externos.size()); i++)
+    {
+        insereNaTabela(externos[i], i);
+    }
+}
+
+void MapaIds::insereNaTabela(long long externo, int indice)
+{
+    size_t mascara = valores.size() - 1;
+    size_t p = posicao(externo);
+    while (valores[p] != -1)
+    {
+        p = (p + 1) & mascara;
+    }
+    chaves[p] = externo;
+    valores[p] = indice;
+}
+
+size_t MapaIds::posicao(long long externo) const
+{
+    // Finalizador do splitmix64: espalha IDs sequenciais ou com padrões pela tabela inteira
+    unsigned long long x = static_cast<unsigned long long>(externo);
+    x ^= x >> 30;
+    x *= 0xBF58476D1CE4E5B9ULL;
+    x ^= x >> 27;
+    x *= 0x94D049BB133111EBULL;
+    x ^= x >> 31;
+    return static_cast<size_t>(x) & (valores.size() - 1);
+}
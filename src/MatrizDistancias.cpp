@@ -0,0 +1,229 @@
+/**
+ * @file MatrizDistancias.cpp
+ * @brief Implementação da matriz de distâncias: Floyd–Warshall em blocos, gravação e mapeamento do arquivo.
+ */
+
+#include "../include/MatrizDistancias.h"
+#include "../include/Paralelo.h"
+#include "../include/VarreduraLinha.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+const float MatrizDistancias::INFINITO = numeric_limits<float>::infinity();
+
+namespace
+{
+    const char ASSINATURA[8] = {'G', 'R', 'D', 'I', 'S', 'T', '0', '1'};
+    const size_t TAMANHO_CABECALHO = 64; // Mantém as linhas do arquivo alinhadas a 64 bytes
+
+    /// Cabeçalho do arquivo de distâncias, completado com zeros até TAMANHO_CABECALHO.
+    struct Cabecalho
+    {
+        char assinatura[8];
+        int32_t ordem;
+        int32_t passo;
+    };
+}
+
+MatrizDistancias::MatrizDistancias()
+    : ordem(0), passo(0), dados(nullptr), mapa(nullptr), tamanhoMapa(0)
+{
+}
+
+MatrizDistancias::~MatrizDistancias()
+{
+    desmapeia();
+}
+
+void MatrizDistancias::desmapeia()
+{
+#ifndef _WIN32
+    if (mapa != nullptr)
+    {
+        munmap(mapa, tamanhoMapa);
+    }
+#endif
+    mapa = nullptr;
+    tamanhoMapa = 0;
+}
+
+void MatrizDistancias::redimensiona(int n)
+{
+    desmapeia();
+    ordem = n;
+    passo = (n + ALINHAMENTO - 1) / ALINHAMENTO * ALINHAMENTO;
+    buffer.assign(static_cast<size_t>(n) * passo, INFINITO);
+    dados = buffer.empty() ? nullptr : buffer.data();
+}
+
+void MatrizDistancias::atualizaBloco(int ib, int jb, int kb)
+{
+    int iFim = min(ib + TAMANHO_BLOCO, ordem);
+    int jFim = min(jb + TAMANHO_BLOCO, ordem);
+    int kFim = min(kb + TAMANHO_BLOCO, ordem);
+    for (int k = kb; k < kFim; k++)
+    {
+        const float *linhaK = linha(k) + jb;
+        for (int i = ib; i < iFim; i++)
+        {
+            float *linhaI = linha(i);
+            float ik = linhaI[k];
+            if (ik != INFINITO)
+            {
+                VarreduraLinha::minMais(linhaI + jb, linhaK, ik, jFim - jb);
+            }
+        }
+    }
+}
+
+void MatrizDistancias::floydWarshall(int numThreads)
+{
+    if (ordem == 0)
+    {
+        return;
+    }
+    numThreads = Paralelo::resolveThreads(numThreads);
+
+    int numBlocos = (ordem + TAMANHO_BLOCO - 1) / TAMANHO_BLOCO;
+    for (int k = 0; k < numBlocos; k++)
+    {
+        int kb = k * TAMANHO_BLOCO;
+
+        // Fase 1: bloco da diagonal, que só depende de si mesmo
+        atualizaBloco(kb, kb, kb);
+
+        // Fase 2: blocos da linha e da coluna k, que dependem apenas do bloco da diagonal
+        Paralelo::executa(2 * (numBlocos - 1), numThreads, [&](int t)
+        {
+            int outro = t / 2;
+            if (outro >= k)
+            {
+                outro++;
+            }
+            int ob = outro * TAMANHO_BLOCO;
+            if (t % 2 == 0)
+            {
+                atualizaBloco(kb, ob, kb);
+            }
+            else
+            {
+                atualizaBloco(ob, kb, kb);
+            }
+        });
+
+        // Fase 3: demais blocos, independentes entre si; cada tarefa é uma faixa de linhas
+        Paralelo::executa(numBlocos - 1, numThreads, [&](int t)
+        {
+            int i = t >= k ? t + 1 : t;
+            for (int j = 0; j < numBlocos; j++)
+            {
+                if (j != k)
+                {
+                    atualizaBloco(i * TAMANHO_BLOCO, j * TAMANHO_BLOCO, kb);
+                }
+            }
+        });
+    }
+}
+
+bool MatrizDistancias::salva(const string &arquivo) const
+{
+    ofstream saida(arquivo, ios::binary | ios::trunc);
+    if (!saida.is_open())
+    {
+        cerr << "Erro: não foi possível gravar a matriz de distâncias em " << arquivo << endl;
+        return false;
+    }
+
+    char bruto[TAMANHO_CABECALHO] = {};
+    Cabecalho cabecalho;
+    memcpy(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA));
+    cabecalho.ordem = ordem;
+    cabecalho.passo = passo;
+    memcpy(bruto, &cabecalho, sizeof(cabecalho));
+    saida.write(bruto, TAMANHO_CABECALHO);
+    if (ordem > 0)
+    {
+        saida.write(reinterpret_cast<const char *>(dados), static_cast<streamsize>(static_cast<size_t>(ordem) * passo * sizeof(float)));
+    }
+    return static_cast<bool>(saida);
+}
+
+bool MatrizDistancias::carrega(const string &arquivo)
+{
+    ifstream entrada(arquivo, ios::binary);
+    if (!entrada.is_open())
+    {
+        cerr << "Erro: não foi possível abrir a matriz de distâncias " << arquivo << endl;
+        return false;
+    }
+
+    char bruto[TAMANHO_CABECALHO];
+    Cabecalho cabecalho;
+    entrada.read(bruto, TAMANHO_CABECALHO);
+    memcpy(&cabecalho, bruto, sizeof(cabecalho));
+    entrada.seekg(0, ios::end);
+    size_t tamanhoArquivo = static_cast<size_t>(entrada.tellg());
+    size_t tamanhoDados = static_cast<size_t>(cabecalho.ordem) * cabecalho.passo * sizeof(float);
+    if (!entrada || memcmp(cabecalho.assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 ||
+        cabecalho.ordem < 0 || cabecalho.passo < cabecalho.ordem || cabecalho.passo % ALINHAMENTO != 0 ||
+        tamanhoArquivo != TAMANHO_CABECALHO + tamanhoDados)
+    {
+        cerr << "Erro: " << arquivo << " não é uma matriz de distâncias válida" << endl;
+        return false;
+    }
+
+    desmapeia();
+    buffer.clear();
+    buffer.shrink_to_fit();
+    ordem = cabecalho.ordem;
+    passo = cabecalho.passo;
+    dados = nullptr;
+    if (ordem == 0)
+    {
+        return true;
+    }
+
+#ifndef _WIN32
+    // Mapeamento privado: as páginas são lidas sob demanda e alterações ficam só na memória
+    int descritor = open(arquivo.c_str(), O_RDONLY);
+    if (descritor >= 0)
+    {
+        void *endereco = mmap(nullptr, tamanhoArquivo, PROT_READ | PROT_WRITE, MAP_PRIVATE, descritor, 0);
+        close(descritor);
+        if (endereco != MAP_FAILED)
+        {
+            mapa = endereco;
+            tamanhoMapa = tamanhoArquivo;
+            dados = reinterpret_cast<float *>(static_cast<char *>(mapa) + TAMANHO_CABECALHO);
+            return true;
+        }
+    }
+#endif
+
+    // Sem mmap: lê o conteúdo para o buffer próprio
+    buffer.resize(static_cast<size_t>(ordem) * passo);
+    entrada.clear();
+    entrada.seekg(TAMANHO_CABECALHO, ios::beg);
+    entrada.read(reinterpret_cast<char *>(buffer.data()), static_cast<streamsize>(tamanhoDados));
+    if (!entrada)
+    {
+        cerr << "Erro: falha ao ler a matriz de distâncias " << arquivo << endl;
+        redimensiona(0);
+        return false;
+    }
+    dados = buffer.data();
+    return true;
+}
@@ -5,12 +5,13 @@
 #include "../include/No.h"
 #include "../include/Aresta.h"
 #include <iostream>
+#include <new>
 
 using namespace std;
 
-No::No(int idNo, float pesoNo)
+No::No(int idNo, float pesoNo, Arena *arenaArestas)
     : idNo(idNo), pesoNo(pesoNo), grauEntrada(0), grauSaida(0),
-      primeiraAresta(nullptr), ultimaAresta(nullptr), proxNo(nullptr) {}
+      primeiraAresta(nullptr), ultimaAresta(nullptr), proxNo(nullptr), arenaArestas(arenaArestas) {}
 
 No::~No()
 {
@@ -18,11 +19,24 @@ No::~No()
     while (arestaAtual != nullptr)
     {
         Aresta *proxAresta = arestaAtual->getProxAresta();
-        delete arestaAtual;
+        liberaAresta(arestaAtual);
         arestaAtual = proxAresta;
     }
 }
 
+void No::liberaAresta(Aresta *aresta)
+{
+    if (arenaArestas != nullptr)
+    {
+        aresta->~Aresta();
+        arenaArestas->libera(aresta);
+    }
+    else
+    {
+        delete aresta;
+    }
+}
+
 int No::getIdNo()
 {
     return idNo;
@@ -60,10 +74,15 @@ void No::setProxNo(No *proxNo)
 
 void No::adicionaAresta(int destino, float peso, bool direcionado)
 {
-    No *destinoNo = obterNoDestino(destino); // Obtém o ponteiro do nó de destino
+    adicionaAresta(obterNoDestino(destino), peso, direcionado);
+}
 
+void No::adicionaAresta(No *destinoNo, float peso, bool direcionado)
+{
     // Criação da nova aresta com os ponteiros para os nós
-    Aresta *novaAresta = new Aresta(this, destinoNo, peso); // Passa os ponteiros para Aresta
+    Aresta *novaAresta = arenaArestas != nullptr
+                             ? new (arenaArestas->aloca()) Aresta(this, destinoNo, peso)
+                             : new Aresta(this, destinoNo, peso); // Passa os ponteiros para Aresta
 
     if (ultimaAresta != nullptr)
     {
@@ -120,7 +139,7 @@ void No::removeAresta(int destino, bool direcionado)
         atual->setNoOrigem(nullptr);
         atual->setNoDestino(nullptr);
 
-        delete atual;
+        liberaAresta(atual);
 
         this->grauSaida--;
         if (!direcionado)
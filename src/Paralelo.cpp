@@ -0,0 +1,54 @@
+/**
+ * @file Paralelo.cpp
+ * @brief Implementação da distribuição de tarefas entre threads.
+ */
+
+#include "../include/Paralelo.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+int Paralelo::resolveThreads(int pedido)
+{
+    if (pedido > 0)
+    {
+        return pedido;
+    }
+    return max(1, static_cast<int>(thread::hardware_concurrency()));
+}
+
+void Paralelo::executa(int numTarefas, int numThreads, const function<void(int)> &tarefa)
+{
+    numThreads = min(numThreads, numTarefas);
+    if (numThreads <= 1)
+    {
+        for (int t = 0; t < numTarefas; t++)
+        {
+            tarefa(t);
+        }
+        return;
+    }
+
+    atomic<int> proxima(0);
+    auto trabalha = [&]()
+    {
+        for (int t = proxima++; t < numTarefas; t = proxima++)
+        {
+            tarefa(t);
+        }
+    };
+    vector<thread> threads;
+    threads.reserve(numThreads - 1);
+    for (int i = 1; i < numThreads; i++)
+    {
+        threads.emplace_back(trabalha);
+    }
+    trabalha();
+    for (thread &t : threads)
+    {
+        t.join();
+    }
+}
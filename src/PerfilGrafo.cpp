@@ -0,0 +1,43 @@
+/**
+ * @file PerfilGrafo.cpp
+ * @brief Serialização do perfil do grafo.
+ */
+
+#include "../include/PerfilGrafo.h"
+#include <sstream>
+
+using namespace std;
+
+string PerfilGrafo::serializa() const
+{
+    ostringstream saida;
+    saida << ordem << ';' << numArestas << ';' << componentes << ';' << componentesBipartidas << ';'
+          << numPontes << ';' << numArticulacoes << ';' << grauMinimo << ';' << grauMaximo << ';'
+          << grauMedio << ';' << (completo ? 1 : 0) << ';' << (arvore ? 1 : 0) << ';' << componentesFortes;
+    return saida.str();
+}
+
+bool PerfilGrafo::desserializa(const string &texto)
+{
+    istringstream entrada(texto);
+    char s[11];
+    int ehCompleto, ehArvore;
+    entrada >> ordem >> s[0] >> numArestas >> s[1] >> componentes >> s[2] >> componentesBipartidas >> s[3] >>
+        numPontes >> s[4] >> numArticulacoes >> s[5] >> grauMinimo >> s[6] >> grauMaximo >> s[7] >>
+        grauMedio >> s[8] >> ehCompleto >> s[9] >> ehArvore >> s[10] >>
+        componentesFortes;
+    if (entrada.fail())
+    {
+        return false;
+    }
+    for (int i = 0; i < 11; i++)
+    {
+        if (s[i] != ';')
+        {
+            return false;
+        }
+    }
+    completo = ehCompleto != 0;
+    arvore = ehArvore != 0;
+    return true;
+}
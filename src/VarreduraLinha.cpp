@@ -0,0 +1,308 @@
+/**
+ * @file VarreduraLinha.cpp
+ * @brief Implementação das varreduras de linhas da matriz (AVX2, SSE2 e escalar) e da escolha em tempo de execução.
+ */
+
+#include "../include/VarreduraLinha.h"
+#include <cstdlib>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define VARREDURA_X86 1
+#include <immintrin.h>
+#endif
+
+using namespace std;
+
+namespace
+{
+    /// Conjunto de implementações escolhido na primeira chamada.
+    struct Implementacao
+    {
+        int (*contaNaoNulos)(const int *, int);
+        int (*contaLivres)(const int *, const int *, int);
+        int (*proximoNaoNulo)(const int *, int, int);
+        int (*proximoLivre)(const int *, const int *, int, int);
+        void (*minMais)(float *, const float *, float, int);
+        const char *nome;
+    };
+
+    // ---------- Versão escalar (referência e alternativa para outras arquiteturas) ----------
+
+    int contaNaoNulosEscalar(const int *linha, int n)
+    {
+        int total = 0;
+        for (int j = 0; j < n; j++)
+        {
+            total += linha[j] != 0;
+        }
+        return total;
+    }
+
+    int contaLivresEscalar(const int *linha, const int *cobertos, int n)
+    {
+        int total = 0;
+        for (int j = 0; j < n; j++)
+        {
+            total += (linha[j] != 0) & (cobertos[j] == 0);
+        }
+        return total;
+    }
+
+    int proximoNaoNuloEscalar(const int *linha, int inicio, int n)
+    {
+        for (int j = inicio; j < n; j++)
+        {
+            if (linha[j] != 0)
+            {
+                return j;
+            }
+        }
+        return n;
+    }
+
+    int proximoLivreEscalar(const int *linha, const int *cobertos, int inicio, int n)
+    {
+        for (int j = inicio; j < n; j++)
+        {
+            if (linha[j] != 0 && cobertos[j] == 0)
+            {
+                return j;
+            }
+        }
+        return n;
+    }
+
+    void minMaisEscalar(float *destino, const float *origem, float valor, int n)
+    {
+        for (int j = 0; j < n; j++)
+        {
+            float candidato = valor + origem[j];
+            destino[j] = candidato < destino[j] ? candidato : destino[j];
+        }
+    }
+
+#ifdef VARREDURA_X86
+    // ---------- SSE2: 4 inteiros por instrução ----------
+    // As contagens acumulam as próprias máscaras de comparação (-1 por acerto) em um registrador,
+    // sem desvios dentro do laço; as buscas só desviam quando o bloco contém um acerto.
+
+    __attribute__((target("sse2"))) int somaSse2(__m128i v)
+    {
+        v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+        v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(v);
+    }
+
+    __attribute__((target("sse2"))) int contaNaoNulosSse2(const int *linha, int n)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i nulos = _mm_setzero_si128();
+        int j = 0;
+        for (; j + 4 <= n; j += 4)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(linha + j));
+            nulos = _mm_sub_epi32(nulos, _mm_cmpeq_epi32(v, zero));
+        }
+        return (j - somaSse2(nulos)) + contaNaoNulosEscalar(linha + j, n - j);
+    }
+
+    __attribute__((target("sse2"))) int contaLivresSse2(const int *linha, const int *cobertos, int n)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        __m128i livres = _mm_setzero_si128();
+        int j = 0;
+        for (; j + 4 <= n; j += 4)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(linha + j));
+            __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cobertos + j));
+            livres = _mm_sub_epi32(livres, _mm_andnot_si128(_mm_cmpeq_epi32(v, zero), _mm_cmpeq_epi32(c, zero)));
+        }
+        return somaSse2(livres) + contaLivresEscalar(linha + j, cobertos + j, n - j);
+    }
+
+    __attribute__((target("sse2"))) int proximoNaoNuloSse2(const int *linha, int inicio, int n)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        int j = inicio;
+        for (; j + 4 <= n; j += 4)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(linha + j));
+            int naoNulos = ~_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(v, zero))) & 0xF;
+            if (naoNulos != 0)
+            {
+                return j + __builtin_ctz(naoNulos);
+            }
+        }
+        return proximoNaoNuloEscalar(linha, j, n);
+    }
+
+    __attribute__((target("sse2"))) int proximoLivreSse2(const int *linha, const int *cobertos, int inicio, int n)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        int j = inicio;
+        for (; j + 4 <= n; j += 4)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(linha + j));
+            __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i *>(cobertos + j));
+            int livres = _mm_movemask_ps(_mm_castsi128_ps(_mm_andnot_si128(_mm_cmpeq_epi32(v, zero), _mm_cmpeq_epi32(c, zero))));
+            if (livres != 0)
+            {
+                return j + __builtin_ctz(livres);
+            }
+        }
+        return proximoLivreEscalar(linha, cobertos, j, n);
+    }
+
+    __attribute__((target("sse2"))) void minMaisSse2(float *destino, const float *origem, float valor, int n)
+    {
+        const __m128 v = _mm_set1_ps(valor);
+        int j = 0;
+        for (; j + 4 <= n; j += 4)
+        {
+            __m128 candidato = _mm_add_ps(v, _mm_loadu_ps(origem + j));
+            _mm_storeu_ps(destino + j, _mm_min_ps(_mm_loadu_ps(destino + j), candidato));
+        }
+        minMaisEscalar(destino + j, origem + j, valor, n - j);
+    }
+
+    // ---------- AVX2: 8 inteiros por instrução ----------
+
+    __attribute__((target("avx2"))) int somaAvx2(__m256i v)
+    {
+        __m128i metade = _mm_add_epi32(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+        metade = _mm_add_epi32(metade, _mm_shuffle_epi32(metade, _MM_SHUFFLE(1, 0, 3, 2)));
+        metade = _mm_add_epi32(metade, _mm_shuffle_epi32(metade, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(metade);
+    }
+
+    __attribute__((target("avx2"))) int contaNaoNulosAvx2(const int *linha, int n)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i nulos = _mm256_setzero_si256();
+        int j = 0;
+        for (; j + 8 <= n; j += 8)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(linha + j));
+            nulos = _mm256_sub_epi32(nulos, _mm256_cmpeq_epi32(v, zero));
+        }
+        return (j - somaAvx2(nulos)) + contaNaoNulosEscalar(linha + j, n - j);
+    }
+
+    __attribute__((target("avx2"))) int contaLivresAvx2(const int *linha, const int *cobertos, int n)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i livres = _mm256_setzero_si256();
+        int j = 0;
+        for (; j + 8 <= n; j += 8)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(linha + j));
+            __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cobertos + j));
+            livres = _mm256_sub_epi32(livres, _mm256_andnot_si256(_mm256_cmpeq_epi32(v, zero), _mm256_cmpeq_epi32(c, zero)));
+        }
+        return somaAvx2(livres) + contaLivresEscalar(linha + j, cobertos + j, n - j);
+    }
+
+    __attribute__((target("avx2"))) int proximoNaoNuloAvx2(const int *linha, int inicio, int n)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        int j = inicio;
+        for (; j + 8 <= n; j += 8)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(linha + j));
+            int naoNulos = ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, zero))) & 0xFF;
+            if (naoNulos != 0)
+            {
+                return j + __builtin_ctz(naoNulos);
+            }
+        }
+        return proximoNaoNuloEscalar(linha, j, n);
+    }
+
+    __attribute__((target("avx2"))) int proximoLivreAvx2(const int *linha, const int *cobertos, int inicio, int n)
+    {
+        const __m256i zero = _mm256_setzero_si256();
+        int j = inicio;
+        for (; j + 8 <= n; j += 8)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(linha + j));
+            __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(cobertos + j));
+            int livres = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_andnot_si256(_mm256_cmpeq_epi32(v, zero), _mm256_cmpeq_epi32(c, zero))));
+            if (livres != 0)
+            {
+                return j + __builtin_ctz(livres);
+            }
+        }
+        return proximoLivreEscalar(linha, cobertos, j, n);
+    }
+
+    __attribute__((target("avx2"))) void minMaisAvx2(float *destino, const float *origem, float valor, int n)
+    {
+        const __m256 v = _mm256_set1_ps(valor);
+        int j = 0;
+        for (; j + 8 <= n; j += 8)
+        {
+            __m256 candidato = _mm256_add_ps(v, _mm256_loadu_ps(origem + j));
+            _mm256_storeu_ps(destino + j, _mm256_min_ps(_mm256_loadu_ps(destino + j), candidato));
+        }
+        minMaisEscalar(destino + j, origem + j, valor, n - j);
+    }
+#endif
+
+    Implementacao detecta()
+    {
+        if (getenv("GRAFO_SEM_SIMD") == nullptr)
+        {
+#ifdef VARREDURA_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+            {
+                Implementacao avx2 = {contaNaoNulosAvx2, contaLivresAvx2, proximoNaoNuloAvx2, proximoLivreAvx2, minMaisAvx2, "avx2"};
+                return avx2;
+            }
+            if (__builtin_cpu_supports("sse2"))
+            {
+                Implementacao sse2 = {contaNaoNulosSse2, contaLivresSse2, proximoNaoNuloSse2, proximoLivreSse2, minMaisSse2, "sse2"};
+                return sse2;
+            }
+#endif
+        }
+        Implementacao escalar = {contaNaoNulosEscalar, contaLivresEscalar, proximoNaoNuloEscalar, proximoLivreEscalar, minMaisEscalar, "escalar"};
+        return escalar;
+    }
+
+    const Implementacao &escolhida()
+    {
+        static const Implementacao implementacao = detecta();
+        return implementacao;
+    }
+}
+
+int VarreduraLinha::contaNaoNulos(const int *linha, int n)
+{
+    return escolhida().contaNaoNulos(linha, n);
+}
+
+int VarreduraLinha::contaLivres(const int *linha, const int *cobertos, int n)
+{
+    return escolhida().contaLivres(linha, cobertos, n);
+}
+
+int VarreduraLinha::proximoNaoNulo(const int *linha, int inicio, int n)
+{
+    return escolhida().proximoNaoNulo(linha, inicio, n);
+}
+
+int VarreduraLinha::proximoLivre(const int *linha, const int *cobertos, int inicio, int n)
+{
+    return escolhida().proximoLivre(linha, cobertos, inicio, n);
+}
+
+void VarreduraLinha::minMais(float *destino, const float *origem, float valor, int n)
+{
+    escolhida().minMais(destino, origem, valor, n);
+}
+
+const char *VarreduraLinha::implementacao()
+{
+    return escolhida().nome;
+}
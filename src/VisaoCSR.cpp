@@ -0,0 +1,145 @@
+/**
+ * @file VisaoCSR.cpp
+ * @brief Implementação da construção da adjacência compacta (CSR).
+ */
+
+#include "../include/VisaoCSR.h"
+
+using namespace std;
+
+void VisaoCSR::constroi(int ordem, const vector<ArestaLida> &arestas, bool direcionado)
+{
+    this->ordem = ordem;
+
+    // Entradas orientadas: nos grafos não direcionados cada aresta gera as duas orientações
+    size_t total = 0;
+    for (size_t k = 0; k < arestas.size(); k++)
+    {
+        total += (direcionado || arestas[k].origem == arestas[k].destino) ? 1 : 2;
+    }
+    vector<int> origens(total), destinos(total);
+    vector<float> valores(total);
+    size_t pos = 0;
+    for (size_t k = 0; k < arestas.size(); k++)
+    {
+        const ArestaLida &a = arestas[k];
+        origens[pos] = a.origem;
+        destinos[pos] = a.destino;
+        valores[pos] = a.peso;
+        pos++;
+        if (!direcionado && a.origem != a.destino)
+        {
+            origens[pos] = a.destino;
+            destinos[pos] = a.origem;
+            valores[pos] = a.peso;
+            pos++;
+        }
+    }
+
+    // Ordenação por contagem em duas passadas (destino, depois origem), estável,
+    // deixando cada linha ordenada por destino e preservando a ordem de leitura entre repetidas
+    vector<int> contagem(ordem + 1);
+    vector<size_t> ordemDestino(total);
+    for (size_t k = 0; k < total; k++)
+    {
+        contagem[destinos[k] + 1]++;
+    }
+    for (int v = 0; v < ordem; v++)
+    {
+        contagem[v + 1] += contagem[v];
+    }
+    for (size_t k = 0; k < total; k++)
+    {
+        ordemDestino[contagem[destinos[k]]++] = k;
+    }
+
+    inicio.assign(ordem + 1, 0);
+    for (size_t k = 0; k < total; k++)
+    {
+        inicio[origens[k] + 1]++;
+    }
+    for (int v = 0; v < ordem; v++)
+    {
+        inicio[v + 1] += inicio[v];
+    }
+    vector<int> proximo(inicio.begin(), inicio.end() - 1);
+    vizinhos.resize(total);
+    pesos.resize(total);
+    for (size_t i = 0; i < total; i++)
+    {
+        size_t k = ordemDestino[i];
+        int p = proximo[origens[k]]++;
+        vizinhos[p] = destinos[k];
+        pesos[p] = valores[k];
+    }
+
+    // Remove entradas repetidas dentro de cada linha (mantém o último peso lido)
+    int escrita = 0;
+    for (int v = 0; v < ordem; v++)
+    {
+        int a = inicio[v];
+        int b = inicio[v + 1];
+        inicio[v] = escrita;
+        for (int i = a; i < b; i++)
+        {
+            if (escrita > inicio[v] && vizinhos[escrita - 1] == vizinhos[i])
+            {
+                pesos[escrita - 1] = pesos[i];
+                continue;
+            }
+            vizinhos[escrita] = vizinhos[i];
+            pesos[escrita] = pesos[i];
+            escrita++;
+        }
+    }
+    inicio[ordem] = escrita;
+    vizinhos.resize(escrita);
+    pesos.resize(escrita);
+}
+
+VisaoCSR VisaoCSR::simetrica() const
+{
+    vector<ArestaLida> arestas;
+    arestas.reserve(vizinhos.size());
+    for (int v = 0; v < ordem; v++)
+    {
+        for (int k = inicio[v]; k < inicio[v + 1]; k++)
+        {
+            ArestaLida aresta = {v, vizinhos[k], pesos[k]};
+            arestas.push_back(aresta);
+        }
+    }
+    VisaoCSR resultado;
+    resultado.constroi(ordem, arestas, false);
+    return resultado;
+}
+
+VisaoCSR VisaoCSR::transposta() const
+{
+    VisaoCSR resultado;
+    resultado.ordem = ordem;
+    resultado.inicio.assign(ordem + 1, 0);
+    resultado.vizinhos.resize(vizinhos.size());
+    resultado.pesos.resize(pesos.size());
+    for (int w : vizinhos)
+    {
+        resultado.inicio[w + 1]++;
+    }
+    for (int v = 0; v < ordem; v++)
+    {
+        resultado.inicio[v + 1] += resultado.inicio[v];
+    }
+
+    // Distribuição por contagem: as origens são visitadas em ordem crescente, então cada lista já sai ordenada
+    vector<int> posicao(resultado.inicio.begin(), resultado.inicio.end() - 1);
+    for (int v = 0; v < ordem; v++)
+    {
+        for (int k = inicio[v]; k < inicio[v + 1]; k++)
+        {
+            int p = posicao[vizinhos[k]]++;
+            resultado.vizinhos[p] = v;
+            resultado.pesos[p] = pesos[k];
+        }
+    }
+    return resultado;
+}